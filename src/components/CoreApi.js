@@ -0,0 +1,176 @@
+// CoreApi.js - Embind-free access to the game core through its plain C ABI
+// (CApi.h). Works with the module built by `make capi`
+// (noise_before_defeat_core_c.js); every call passes only numbers, and state
+// is read straight out of Wasm memory.
+
+import { ACTION_CODES, SUBMIT_RESULTS, ACTION_TUPLE_WORDS, packTurn } from './GameInterface';
+
+// NBD_INVALID_MATCH in CApi.h (INT32_MIN); never a valid result, so the
+// integer getters map it to null
+const INVALID_MATCH = -2147483648;
+const orNull = (value) => (value === INVALID_MATCH ? null : value);
+
+export class CoreMatch {
+  constructor(module, player1Name, player2Name) {
+    this.module = module;
+    const name1 = module.stringToNewUTF8(player1Name);
+    const name2 = module.stringToNewUTF8(player2Name);
+    this.handle = module._nbd_create_match(name1, name2);
+    module._nbd_free(name1);
+    module._nbd_free(name2);
+    if (this.handle === 0) {
+      throw new Error('No free match slots');
+    }
+
+    // Tuple and result buffers in Wasm memory, grown on demand
+    this.capacity = 0;
+    this.tuples = 0;
+    this.results = 0;
+  }
+
+  destroy() {
+    this.module._nbd_free(this.tuples);
+    this.module._nbd_free(this.results);
+    this.module._nbd_destroy_match(this.handle);
+    this.handle = 0;
+  }
+
+  submitAction(playerId, action, x, y) {
+    const code = this.module._nbd_submit_action(this.handle, playerId, ACTION_CODES.indexOf(action), x, y);
+    return code === INVALID_MATCH ? null : SUBMIT_RESULTS[code];
+  }
+
+  // Same contract as GameInterface.submitTurn
+  submitTurn(actions) {
+    const packed = actions instanceof Int32Array ? actions : packTurn(actions);
+    const count = packed.length / ACTION_TUPLE_WORDS;
+    this._reserve(count);
+    this.module.HEAP32.set(packed, this.tuples >> 2);
+    const accepted = this.module._nbd_submit_turn(this.handle, this.tuples, count, this.results);
+    if (accepted === INVALID_MATCH) {
+      return null;
+    }
+    const codes = this.module.HEAP32.subarray(this.results >> 2, (this.results >> 2) + count);
+    return Array.from(codes, (code) => SUBMIT_RESULTS[code]);
+  }
+
+  endTurn() {
+    return orNull(this.module._nbd_end_turn(this.handle));
+  }
+
+  getCurrentTurn() {
+    return orNull(this.module._nbd_get_turn(this.handle));
+  }
+
+  getGamePhase() {
+    return orNull(this.module._nbd_get_phase(this.handle));
+  }
+
+  getWinner() {
+    return orNull(this.module._nbd_get_winner(this.handle));
+  }
+
+  getStateVersion() {
+    return this.module._nbd_get_state_version(this.handle) >>> 0;
+  }
+
+  // Int32Array view over the packed board mirror (no copy); same layout
+  // and lifetime rules as GameInterface.getBoardView
+  getBoardView() {
+    const ptr = this.module._nbd_get_board_view(this.handle);
+    const size = this.module._nbd_get_board_view_size(this.handle);
+    return this.module.HEAP32.subarray(ptr >> 2, (ptr >> 2) + size);
+  }
+
+  getStateDelta(sinceVersion) {
+    return this.module.UTF8ToString(this.module._nbd_get_state_delta(this.handle, sinceVersion));
+  }
+
+  getGameState() {
+    return this.module.UTF8ToString(this.module._nbd_get_state(this.handle));
+  }
+
+  getPlayerState(playerId) {
+    return this.module.UTF8ToString(this.module._nbd_get_player_state(this.handle, playerId));
+  }
+
+  // Uint8Array copy of the binary snapshot
+  saveSnapshot() {
+    const ptr = this.module._nbd_save_snapshot(this.handle);
+    const size = this.module._nbd_get_snapshot_size(this.handle);
+    return this.module.HEAPU8.slice(ptr, ptr + size);
+  }
+
+  // Float64Array copy of the runtime counters (METRICS_WORDS layout)
+  getMetrics() {
+    const words = this.module._nbd_get_metrics(this.handle, 0, 0);
+    if (words === INVALID_MATCH) {
+      return null;
+    }
+    const ptr = this.module._nbd_alloc(words * 8);
+    this.module._nbd_get_metrics(this.handle, ptr, words);
+    const metrics = this.module.HEAPF64.slice(ptr >> 3, (ptr >> 3) + words);
+    this.module._nbd_free(ptr);
+    return metrics;
+  }
+
+  getCacheStats() {
+    return {
+      hits: this.module._nbd_get_cache_hits(this.handle) >>> 0,
+      misses: this.module._nbd_get_cache_misses(this.handle) >>> 0
+    };
+  }
+
+  loadSnapshot(bytes) {
+    const ptr = this.module._nbd_alloc(bytes.length);
+    this.module.HEAPU8.set(bytes, ptr);
+    const loaded = this.module._nbd_load_snapshot(this.handle, ptr, bytes.length) === 1;
+    this.module._nbd_free(ptr);
+    return loaded;
+  }
+
+  _reserve(count) {
+    if (count <= this.capacity) return;
+    this.module._nbd_free(this.tuples);
+    this.module._nbd_free(this.results);
+    this.capacity = Math.max(count, 2 * this.capacity, 16);
+    this.tuples = this.module._nbd_alloc(this.capacity * ACTION_TUPLE_WORDS * 4);
+    this.results = this.module._nbd_alloc(this.capacity * 4);
+  }
+}
+
+// Per-call overhead of the Embind wrapper versus the C ABI, in microseconds
+// per call: a trivial getter, and a whole-turn submission. Pass the two
+// instantiated modules; run from the browser console.
+export const measureCallOverhead = (embindModule, capiModule, iterations = 100000) => {
+  const time = (fn) => {
+    const start = performance.now();
+    for (let i = 0; i < iterations; ++i) fn(i);
+    return ((performance.now() - start) * 1000) / iterations;
+  };
+
+  const embind = new embindModule.GameState();
+  embind.initializeGame('Player 1', 'Player 2');
+  const capi = new CoreMatch(capiModule, 'Player 1', 'Player 2');
+  const turn = packTurn([
+    { playerId: 0, action: 'spy', x: 0, y: 0 },
+    { playerId: 1, action: 'spy', x: 0, y: 0 }
+  ]);
+
+  // Submitting fills each player's share of the action queue, which then
+  // rejects their further actions; both sides do the same work either way
+  const results = {
+    getCurrentTurn: {
+      embind: time(() => embind.getCurrentTurn()),
+      capi: time(() => capi.getCurrentTurn())
+    },
+    submitTurn: {
+      embind: time(() => embind.submitTurn(turn)),
+      capi: time(() => capi.submitTurn(turn))
+    }
+  };
+
+  embind.delete();
+  capi.destroy();
+  return results;
+};
@@ -1,10 +1,11 @@
 import React, { forwardRef } from 'react';
 import './NoiseBeforeDefeat.css';
+import { BOARD_VIEW_HEADER, BOARD_VIEW_FIELDS, BOARD_VIEW_KINDS, boardViewField } from './GameInterface';
 
 const GameBoard = forwardRef(({
   gridSize,
   cellSize,
-  players,
+  boardView,
   selectedPosition,
   validMoves,
   onCellClick
@@ -329,57 +330,38 @@ const GameBoard = forwardRef(({
     );
   };
   
-  // Render all game elements
+  // Render all game elements straight out of the core's packed board view.
+  // Units are drawn before nodes so nodes stay on top.
   const renderGameElements = () => {
-    const elements = [];
+    const units = [];
+    const nodes = [];
     
-    if (!players || players.length < 2) return elements;
+    if (!boardView) return units;
     
-    // Render player 1 elements
-    const player1 = players[0];
-    
-    // Render infantry
-    if (player1.infantry) {
-      for (const infantry of player1.infantry) {
-        elements.push(renderInfantry(infantry, 0));
-      }
-    }
-    
-    // Render long range
-    if (player1.longRange) {
-      elements.push(renderLongRange(player1.longRange, 0));
-    }
-    
-    // Render nodes
-    if (player1.nodes) {
-      for (const nodeType in player1.nodes) {
-        elements.push(renderNode(player1.nodes[nodeType], nodeType, 0));
-      }
-    }
-    
-    // Render player 2 elements
-    const player2 = players[1];
-    
-    // Render infantry
-    if (player2.infantry) {
-      for (const infantry of player2.infantry) {
-        elements.push(renderInfantry(infantry, 1));
-      }
-    }
-    
-    // Render long range
-    if (player2.longRange) {
-      elements.push(renderLongRange(player2.longRange, 1));
-    }
-    
-    // Render nodes
-    if (player2.nodes) {
-      for (const nodeType in player2.nodes) {
-        elements.push(renderNode(player2.nodes[nodeType], nodeType, 1));
+    const entityCount = boardView[BOARD_VIEW_HEADER.ENTITY_COUNT];
+    for (let entity = 0; entity < entityCount; entity++) {
+      const field = (name) => boardViewField(boardView, BOARD_VIEW_FIELDS[name], entity);
+      const kind = BOARD_VIEW_KINDS[field('KIND')];
+      const playerId = field('OWNER');
+      const element = {
+        id: `entity-${entity}`,
+        posX: field('POS_X'),
+        posY: field('POS_Y'),
+        hp: field('HP'),
+        maxHp: field('MAX_HP'),
+        count: field('COUNT')
+      };
+      
+      if (kind === 'infantry') {
+        units.push(renderInfantry(element, playerId));
+      } else if (kind === 'longRange') {
+        units.push(renderLongRange(element, playerId));
+      } else {
+        nodes.push(renderNode(element, kind, playerId));
       }
     }
     
-    return elements;
+    return units.concat(nodes);
   };
   
   return (
@@ -4,6 +4,82 @@ import NoiseBeforeDefeatCore from '../public/wasm/noise_before_defeat_core.js';
 
 // GameInterface.js - Bridge between WASM Core and React UI
 
+// Layout of the packed board view (mirrors BoardView.h in the core)
+export const BOARD_VIEW_HEADER = {
+  LAYOUT_VERSION: 0,
+  STATE_VERSION: 1,
+  TURN: 2,
+  PHASE: 3,
+  WINNER: 4,
+  ENTITY_COUNT: 5,
+  CAPACITY: 6
+};
+export const BOARD_VIEW_HEADER_WORDS = 8;
+export const BOARD_VIEW_FIELDS = {
+  OWNER: 0,
+  KIND: 1,
+  POS_X: 2,
+  POS_Y: 3,
+  HP: 4,
+  MAX_HP: 5,
+  COUNT: 6,
+  FLAGS: 7
+};
+export const BOARD_VIEW_KINDS = ['core', 'comms', 'rd', 'infantry', 'longRange'];
+
+// Action codes and per-action results for submitTurn (mirror ActionType and
+// SubmitResult in Action.h)
+export const ACTION_CODES = ['move', 'attack', 'hack', 'defend', 'spy'];
+export const SUBMIT_RESULTS = ['accepted', 'wrongPhase', 'invalidPlayer', 'invalidAction', 'queueFull', 'invalidUnit'];
+export const ACTION_TUPLE_WORDS = 5;
+
+// Pack [{playerId, action, x, y, unit}] into the Int32Array submitTurn takes.
+// unit is an optional unit handle; unknown action names pack as -1, which
+// the core rejects.
+export const packTurn = (actions) => {
+  const packed = new Int32Array(actions.length * ACTION_TUPLE_WORDS);
+  actions.forEach(({ playerId, action, x, y, unit = 0 }, i) => {
+    packed.set([playerId, ACTION_CODES.indexOf(action), x, y, unit], i * ACTION_TUPLE_WORDS);
+  });
+  return packed;
+};
+
+// Unit handle from a JSON unit id ("p0-inf-257" -> 257), 0 if it has none
+export const parseUnitHandle = (id) => {
+  const handle = Number(String(id).slice(String(id).lastIndexOf('-') + 1));
+  return Number.isInteger(handle) && handle > 0 ? handle : 0;
+};
+
+// Layout of the getMetrics Float64Array (mirrors Metrics.h in the core).
+// Accepted/rejected hold one count per ACTION_CODES entry plus a last one
+// for unknown codes; times are in microseconds.
+export const METRICS_LAYOUT_VERSION = 2;
+export const METRICS_ACTION_SLOTS = ACTION_CODES.length + 1;
+export const METRICS_TURN_TIME_BUCKETS = 16;
+export const METRICS_WORDS = {
+  LAYOUT_VERSION: 0,
+  ACCEPTED: 1,
+  REJECTED: 1 + METRICS_ACTION_SLOTS,
+  TURNS: 1 + 2 * METRICS_ACTION_SLOTS,
+  TURN_TIME_TOTAL: 2 + 2 * METRICS_ACTION_SLOTS,
+  TURN_TIME_MAX: 3 + 2 * METRICS_ACTION_SLOTS,
+  TURN_TIME_HISTOGRAM: 4 + 2 * METRICS_ACTION_SLOTS,
+  SERIALIZATIONS: 4 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  SERIALIZED_BYTES: 5 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  SERIALIZATION_TIME: 6 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  CACHE_HITS: 7 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  CACHE_MISSES: 8 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  LOG_ENTRIES: 9 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  LOG_TOTAL: 10 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  HEAP_BYTES: 11 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  ARENA_PEAK_BYTES: 12 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS,
+  ARENA_HEAP_ALLOCATIONS: 13 + 2 * METRICS_ACTION_SLOTS + METRICS_TURN_TIME_BUCKETS
+};
+
+// Read one field of one entity straight out of a board view Int32Array
+export const boardViewField = (view, field, entity) =>
+  view[BOARD_VIEW_HEADER_WORDS + field * view[BOARD_VIEW_HEADER.CAPACITY] + entity];
+
 class GameInterface {
   constructor() {
     this.module = null;
@@ -43,14 +119,46 @@ class GameInterface {
     this._notifyStateUpdate();
   }
 
-  // Submit an action to the game
+  // Submit an action to the game; returns its SUBMIT_RESULTS name
   submitAction(playerId, actionType, x, y) {
     if (!this.isInitialized) {
       throw new Error('Game core not initialized');
     }
 
-    this.gameState.submitAction(playerId, actionType, x, y);
+    const code = this.gameState.submitAction(playerId, actionType, x, y);
+    this._notifyStateUpdate();
+    return SUBMIT_RESULTS[code];
+  }
+
+  // Submit a whole turn in one call across the Wasm boundary. Takes
+  // [{playerId, action, x, y, unit}] or an already packed Int32Array, and
+  // returns one SUBMIT_RESULTS name per action.
+  submitTurn(actions) {
+    if (!this.isInitialized) {
+      throw new Error('Game core not initialized');
+    }
+
+    const packed = actions instanceof Int32Array ? actions : packTurn(actions);
+    const codes = this.gameState.submitTurn(packed);
     this._notifyStateUpdate();
+    return codes ? Array.from(codes, (code) => SUBMIT_RESULTS[code]) : null;
+  }
+
+  // Ask the core's MCTS opponent for this turn's actions ([{action, x, y, unit}]).
+  // Pass 0 for either budget to leave it unlimited (at least one must be set).
+  getAiActions(playerId, { iterations = 2000, timeLimitMs = 0, actionsPerTurn = 1 } = {}) {
+    if (!this.isInitialized) {
+      throw new Error('Game core not initialized');
+    }
+
+    return this.gameState.getAiActions(playerId, iterations, timeLimitMs, actionsPerTurn);
+  }
+
+  // Let the AI submit its actions for this turn
+  playAiTurn(playerId, options) {
+    const actions = this.getAiActions(playerId, options);
+    this.submitTurn(actions.map(({ action, x, y, unit }) => ({ playerId, action, x, y, unit })));
+    return actions;
   }
 
   // End the current turn
@@ -63,15 +171,95 @@ class GameInterface {
     this._notifyStateUpdate();
   }
 
-  // Get full game state as JSON
+  // Get full game state as JSON. The core caches it per state version, so
+  // calling this on every render only re-encodes after a change.
   getGameState() {
     return this.gameState.getGameState();
   }
 
+  // Runtime counters as a Float64Array laid out per METRICS_WORDS; cheap
+  // enough to sample with every telemetry batch
+  getMetrics() {
+    return this.gameState.getMetrics();
+  }
+
+  // Clears the counters, including the cache counters
+  resetMetrics() {
+    this.gameState.resetMetrics();
+  }
+
+  // Chrome trace-event JSON of the recent core spans, for chrome://tracing
+  // or Perfetto. Empty unless the module was built with `make TRACE=1`.
+  getTraceJson() {
+    return this.module.getTraceJson();
+  }
+
+  clearTrace() {
+    this.module.clearTrace();
+  }
+
+  // Serialization cache counters ({ hits, misses }) since the last reset
+  getCacheStats() {
+    return this.gameState.getCacheStats();
+  }
+
+  resetCacheStats() {
+    this.gameState.resetCacheStats();
+  }
+
+  // Game state as one player sees it (JSON): enemy nodes and units outside
+  // that player's vision are left out, and visibleCells lists the cells it
+  // can see as flat [x, y, ...] pairs
+  getPlayerState(playerId) {
+    return this.gameState.getPlayerState(playerId);
+  }
+
+  // Version of the core state; increases whenever anything changes
+  getStateVersion() {
+    return this.gameState.getStateVersion();
+  }
+
+  // Only what changed after sinceVersion (JSON). When `reset` is true the
+  // delta is a full state and any previously held state must be discarded.
+  getStateDelta(sinceVersion) {
+    return this.gameState.getStateDelta(sinceVersion);
+  }
+
+  // Zero-copy Int32Array over the core's packed board mirror. Re-acquire
+  // it after every state change instead of caching it across frames.
+  getBoardView() {
+    return this.gameState.getBoardView();
+  }
+
+  // Entity indices (into the board view) standing on cell (x, y)
+  getEntitiesAt(x, y) {
+    return this.gameState.getEntitiesAt(x, y);
+  }
+
+  // Entity indices of enemies a unit can attack from where it stands.
+  // kind is BOARD_VIEW_KINDS.indexOf('infantry') (with the group index) or
+  // BOARD_VIEW_KINDS.indexOf('longRange').
+  getEnemiesInRange(playerId, kind, index = 0) {
+    return this.gameState.getEnemiesInRange(playerId, kind, index);
+  }
+
   // Load game state from JSON
   loadGameState(jsonState) {
-    this.gameState.loadGameState(jsonState);
+    const loaded = this.gameState.loadGameState(jsonState);
     this._notifyStateUpdate();
+    return loaded;
+  }
+
+  // Save the full match (including pending actions) as a binary snapshot
+  saveSnapshot() {
+    return this.gameState.saveSnapshot();
+  }
+
+  // Restore a match from a Uint8Array produced by saveSnapshot
+  loadSnapshot(bytes) {
+    const loaded = this.gameState.loadSnapshot(bytes);
+    this._notifyStateUpdate();
+    return loaded;
   }
 
   // Get player information
@@ -84,6 +272,34 @@ class GameInterface {
     return this.gameState.getGameLog();
   }
 
+  // Get up to `count` log entries starting at sequence number `from`.
+  // Only the entries between getLogStart() and getLogEnd() are retained.
+  getLogRange(from, count) {
+    return this.gameState.getLogRange(from, count);
+  }
+
+  getLogStart() {
+    return this.gameState.getLogStart();
+  }
+
+  getLogEnd() {
+    return this.gameState.getLogEnd();
+  }
+
+  // Game state JSON at the start of a past turn, rebuilt from the action
+  // journal; empty outside getJournalStart()..getJournalEnd()
+  getReplayState(turn) {
+    return this.gameState.getReplayState(turn);
+  }
+
+  getJournalStart() {
+    return this.gameState.getJournalStart();
+  }
+
+  getJournalEnd() {
+    return this.gameState.getJournalEnd();
+  }
+
   // Check if the game is over
   isGameOver() {
     return this.gameState.isGameOver();
@@ -1,5 +1,5 @@
 import React, { useState, useEffect, useRef } from 'react';
-import gameInterface from './GameInterface';
+import gameInterface, { BOARD_VIEW_FIELDS, BOARD_VIEW_KINDS, boardViewField, parseUnitHandle } from './GameInterface';
 import './NoiseBeforeDefeat.css';
 import GameBoard from './GameBoard';
 import ActionPanel from './ActionPanel';
@@ -17,7 +17,9 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
   const [isInitialized, setIsInitialized] = useState(false);
   const [selectedAction, setSelectedAction] = useState(null);
   const [selectedPosition, setSelectedPosition] = useState(null);
+  const [selectedUnit, setSelectedUnit] = useState(null);
   const [validMoves, setValidMoves] = useState([]);
+  const [plannedActions, setPlannedActions] = useState([]); // Submitted together on ready
   const [showResultModal, setShowResultModal] = useState(false);
   const [loading, setLoading] = useState(true);
   
@@ -57,15 +59,23 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
     initGame();
   }, [currentUser]);
   
+  // Plans belong to one turn: drop any that were never submitted once the
+  // turn or phase moves on, rather than carrying them into the next turn
+  useEffect(() => {
+    setPlannedActions([]);
+  }, [gameData?.currentTurn, gameData?.phase]);
+  
   // Handle action selection
   const handleActionSelection = (action) => {
     if (selectedAction === action) {
       setSelectedAction(null);
       setSelectedPosition(null);
+      setSelectedUnit(null);
       setValidMoves([]);
     } else {
       setSelectedAction(action);
       setSelectedPosition(null);
+      setSelectedUnit(null);
       setValidMoves([]);
     }
   };
@@ -79,17 +89,21 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
     
     if (selectedAction) {
       if (selectedPosition) {
-        // Second click with action and position selected - execute action
-        gameInterface.submitAction(activePlayer, selectedAction, x, y);
+        // Second click with action and position selected - plan the action
+        const unit = selectedUnit ? selectedUnit.handle : 0;
+        setPlannedActions([...plannedActions, { playerId: activePlayer, action: selectedAction, x, y, unit }]);
         setSelectedAction(null);
         setSelectedPosition(null);
+        setSelectedUnit(null);
         setValidMoves([]);
       } else {
         // First click with action selected - select position
+        const unit = findUnitAt(gameData.players[activePlayer], x, y);
         setSelectedPosition({ x, y });
+        setSelectedUnit(unit);
         
-        // Calculate valid moves based on action and position
-        const moves = calculateValidMoves(selectedAction, { x, y }, gameData);
+        // Calculate valid moves based on action and the unit selected
+        const moves = calculateValidMoves(selectedAction, { x, y }, activePlayer, unit);
         setValidMoves(moves);
       }
     } else {
@@ -103,8 +117,20 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
     if (!gameData) return;
     const activePlayer = gameData.currentTurn % 2;
     
+    // Submit the planned turn in one call, then end the turn.
     // In a real implementation, this would mark the player as ready
-    // For now, just end the turn
+    if (plannedActions.length > 0) {
+      const results = gameInterface.submitTurn(plannedActions);
+      if (!results) {
+        console.warn('Planned turn was not submitted: malformed action tuples');
+      }
+      (results || []).forEach((result, i) => {
+        if (result !== 'accepted') {
+          console.warn(`Action ${plannedActions[i].action} rejected: ${result}`);
+        }
+      });
+      setPlannedActions([]);
+    }
     gameInterface.endTurn();
   };
   
@@ -123,14 +149,27 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
     setShowResultModal(false);
   };
   
-  // Helper function to calculate valid moves
-  const calculateValidMoves = (action, position, gameData) => {
-    // This is a simplified implementation
-    // In a real game, this would be handled by the C++ logic
+  // The active player's live unit on (x, y), as the kind and index
+  // getEnemiesInRange takes plus the handle actions name it by
+  const findUnitAt = (player, x, y) => {
+    const at = (unit) => unit && unit.count > 0 && unit.posX === x && unit.posY === y;
+    if (at(player.longRange)) {
+      return { kind: BOARD_VIEW_KINDS.indexOf('longRange'), index: 0, handle: parseUnitHandle(player.longRange.id) };
+    }
+    const index = (player.infantry || []).findIndex(at);
+    if (index >= 0) {
+      return { kind: BOARD_VIEW_KINDS.indexOf('infantry'), index, handle: parseUnitHandle(player.infantry[index].id) };
+    }
+    return null;
+  };
+  
+  // Helper function to calculate valid moves. Moves and attacks ask the
+  // core's board index; hacks have no unit and keep the plain range.
+  const calculateValidMoves = (action, position, playerId, unit) => {
     const moves = [];
     
-    if (action === 'move') {
-      // Add all adjacent cells as valid moves
+    if (action === 'move' && unit) {
+      // A unit steps onto any free adjacent cell
       for (let dx = -1; dx <= 1; dx++) {
         for (let dy = -1; dy <= 1; dy++) {
           if (dx === 0 && dy === 0) continue;
@@ -138,22 +177,23 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
           const newX = position.x + dx;
           const newY = position.y + dy;
           
-          // Check if valid position (within board bounds)
-          if (Math.abs(newX) + Math.abs(newY) <= GRID_SIZE) {
-            // Check if cell is occupied (simplified)
-            let isOccupied = false;
-            
-            // In a real implementation, we would check for occupancy
-            // For now, we'll just add it as a valid move
-            if (!isOccupied) {
-              moves.push({ x: newX, y: newY });
-            }
+          if (Math.abs(newX) + Math.abs(newY) <= GRID_SIZE &&
+              gameInterface.getEntitiesAt(newX, newY).length === 0) {
+            moves.push({ x: newX, y: newY });
           }
         }
       }
-    } else if (action === 'attack' || action === 'hack') {
-      // Add nearby cells as potential targets
-      const range = action === 'attack' ? 1 : 3;
+    } else if (action === 'attack' && unit) {
+      // The cells of the enemies the unit reaches from where it stands
+      const view = gameInterface.getBoardView();
+      for (const entity of gameInterface.getEnemiesInRange(playerId, unit.kind, unit.index)) {
+        moves.push({
+          x: boardViewField(view, BOARD_VIEW_FIELDS.POS_X, entity),
+          y: boardViewField(view, BOARD_VIEW_FIELDS.POS_Y, entity)
+        });
+      }
+    } else if (action === 'hack') {
+      const range = 3;
       
       for (let dx = -range; dx <= range; dx++) {
         for (let dy = -range; dy <= range; dy++) {
@@ -232,7 +272,7 @@ const NoiseBeforeDefeat = ({ gameMode = "standard", onGameEnd, currentUser }) =>
             ref={svgRef}
             gridSize={GRID_SIZE}
             cellSize={CELL_SIZE}
-            players={gameData.players}
+            boardView={gameInterface.getBoardView()}
             selectedPosition={selectedPosition}
             validMoves={validMoves}
             onCellClick={handleCellClick}
@@ -0,0 +1,42 @@
+#include "Action.h"
+
+namespace {
+
+const char* const ACTION_TYPE_NAMES[] = { "move", "attack", "hack", "defend", "spy" };
+const char* const TARGET_TYPE_NAMES[] = { "infantry", "longRange", "core", "comms", "rd" };
+
+static_assert(sizeof(ACTION_TYPE_NAMES) / sizeof(ACTION_TYPE_NAMES[0]) == static_cast<size_t>(ActionType::COUNT),
+              "ACTION_TYPE_NAMES must cover every ActionType");
+static_assert(sizeof(TARGET_TYPE_NAMES) / sizeof(TARGET_TYPE_NAMES[0]) == static_cast<size_t>(TargetType::COUNT),
+              "TARGET_TYPE_NAMES must cover every TargetType");
+
+template <typename Enum, size_t N>
+bool parseName(const char* const (&names)[N], const std::string& name, Enum& out) {
+    for (size_t i = 0; i < N; ++i) {
+        if (name == names[i]) {
+            out = static_cast<Enum>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+const char* getActionTypeName(ActionType type) {
+    size_t index = static_cast<size_t>(type);
+    return index < static_cast<size_t>(ActionType::COUNT) ? ACTION_TYPE_NAMES[index] : "unknown";
+}
+
+bool parseActionType(const std::string& name, ActionType& out) {
+    return parseName(ACTION_TYPE_NAMES, name, out);
+}
+
+const char* getTargetTypeName(TargetType type) {
+    size_t index = static_cast<size_t>(type);
+    return index < static_cast<size_t>(TargetType::COUNT) ? TARGET_TYPE_NAMES[index] : "unknown";
+}
+
+bool parseTargetType(const std::string& name, TargetType& out) {
+    return parseName(TARGET_TYPE_NAMES, name, out);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "HandleTable.h"
+#include "Position.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Actions a player can queue during the planning phase. Values index the
+// validator/executor table in GameState, so keep COUNT last.
+enum class ActionType : uint8_t {
+    MOVE,
+    ATTACK,
+    HACK,
+    DEFEND,
+    SPY,
+    COUNT
+};
+
+// What an attack is aimed at; selects the damage rule in calculateAttackDamage
+enum class TargetType : uint8_t {
+    INFANTRY,
+    LONG_RANGE,
+    CORE,
+    COMMS,
+    RD,
+    COUNT
+};
+
+// unit names the acting unit, or is INVALID_UNIT_HANDLE to let the action
+// pick its units (an attack then uses every unit in reach of the target)
+struct Action {
+    int playerId;
+    ActionType type;
+    Position targetPos;
+    UnitHandle unit;
+};
+
+// Outcome of submitting an action. Batch submission returns one code per
+// action, so keep the values stable.
+enum class SubmitResult : int32_t {
+    ACCEPTED,
+    WRONG_PHASE,
+    INVALID_PLAYER,
+    INVALID_ACTION,     // Unknown action code, or the rules reject it
+    QUEUE_FULL,         // The player already has MAX_PENDING_ACTIONS_PER_PLAYER queued
+    INVALID_UNIT        // Names a unit the player does not have, or a dead one
+};
+
+// Batch submission packs each action as ACTION_TUPLE_WORDS int32s:
+// player id, ActionType code, target x, target y, unit handle (0 for none)
+const std::size_t ACTION_TUPLE_WORDS = 5;
+
+// String conversion for the JS boundary and for log text. Parsing returns
+// false for unknown names and leaves out untouched.
+const char* getActionTypeName(ActionType type);
+bool parseActionType(const std::string& name, ActionType& out);
+const char* getTargetTypeName(TargetType type);
+bool parseTargetType(const std::string& name, TargetType& out);
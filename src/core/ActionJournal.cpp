@@ -0,0 +1,65 @@
+#include "ActionJournal.h"
+#include "GameState.h"
+
+ActionJournal::ActionJournal()
+    : m_firstTurn(1)
+{
+}
+
+void ActionJournal::reset(const CoreState& start) {
+    m_firstTurn = start.currentTurn;
+    m_actions.clear();
+    m_turnEnds.clear();
+    m_checkpoints.clear();
+    // A no-op once the capacity is there, as on every MCTS restore
+    m_actions.reserve(static_cast<size_t>(RESERVED_TURNS) * MAX_PENDING_ACTIONS);
+    m_turnEnds.reserve(RESERVED_TURNS);
+    m_checkpoints.reserve(RESERVED_TURNS / CHECKPOINT_INTERVAL + 1);
+    m_checkpoints.push_back(start);
+    m_checkpoints.back().pendingActions.clear();
+}
+
+void ActionJournal::recordTurn(const ActionQueue& actions, const CoreState& after) {
+    m_actions.insert(m_actions.end(), actions.begin(), actions.end());
+    m_turnEnds.push_back(static_cast<uint32_t>(m_actions.size()));
+
+    if (getTurnCount() % CHECKPOINT_INTERVAL == 0 && after.phase == GamePhase::PLANNING) {
+        m_checkpoints.push_back(after);
+        m_checkpoints.back().pendingActions.clear();
+    }
+}
+
+const Action* ActionJournal::getTurnActions(int turn, size_t& count) const {
+    int index = turn - m_firstTurn;
+    if (index < 0 || index >= getTurnCount()) {
+        count = 0;
+        return nullptr;
+    }
+    uint32_t begin = index > 0 ? m_turnEnds[index - 1] : 0;
+    count = m_turnEnds[index] - begin;
+    return m_actions.data() + begin;
+}
+
+bool ActionJournal::seek(int turn, GameState& out) const {
+    if (turn < m_firstTurn || turn > getEndTurn() || m_checkpoints.empty()) {
+        return false;
+    }
+
+    // The checkpoint after a game-ending turn is never taken
+    size_t checkpoint = static_cast<size_t>((turn - m_firstTurn) / CHECKPOINT_INTERVAL);
+    if (checkpoint >= m_checkpoints.size()) {
+        checkpoint = m_checkpoints.size() - 1;
+    }
+    if (!out.restore(m_checkpoints[checkpoint])) {
+        return false;
+    }
+
+    for (int replayed = m_firstTurn + static_cast<int>(checkpoint) * CHECKPOINT_INTERVAL; replayed < turn; ++replayed) {
+        size_t count = 0;
+        const Action* actions = getTurnActions(replayed, count);
+        if (!out.replayTurn(actions, count)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Action.h"
+#include "CoreState.h"
+
+class GameState;
+
+// Append-only record of a match: the actions resolved in every turn, plus a
+// CoreState checkpoint at the start of every CHECKPOINT_INTERVAL-th turn.
+// Turn resolution is deterministic, so any turn can be rebuilt by restoring
+// the nearest earlier checkpoint and re-resolving at most
+// CHECKPOINT_INTERVAL - 1 turns, however long the match has run.
+class ActionJournal {
+public:
+    static const int CHECKPOINT_INTERVAL = 16;
+    // reset() reserves room for this many full turns (past the 200-turn cap
+    // of the simulator and match host), so recording them never allocates
+    // inside processActions. Longer matches grow the journal as needed.
+    static const int RESERVED_TURNS = 256;
+
+    ActionJournal();
+
+    // Start over from the given state; its pending actions are dropped from
+    // the checkpoint and recorded with the turn they resolve in instead
+    void reset(const CoreState& start);
+
+    // Called by GameState::processActions with the turn's actions and the
+    // state the turn left behind (its pending actions are ignored)
+    void recordTurn(const ActionQueue& actions, const CoreState& after);
+
+    // Recorded turns are [getFirstTurn(), getEndTurn())
+    int getFirstTurn() const { return m_firstTurn; }
+    int getEndTurn() const { return m_firstTurn + getTurnCount(); }
+    int getTurnCount() const { return static_cast<int>(m_turnEnds.size()); }
+    size_t getCheckpointCount() const { return m_checkpoints.size(); }
+
+    // Actions resolved in a recorded turn
+    const Action* getTurnActions(int turn, size_t& count) const;
+
+    // Rebuild `out` as it stood at the start of `turn`, before any action
+    // was submitted; getEndTurn() gives the state after the last recorded
+    // turn. Names are kept and replayed events are appended to out's log.
+    // out restarts its own journal, so it must not be the game that owns
+    // this one.
+    bool seek(int turn, GameState& out) const;
+
+private:
+    int m_firstTurn;
+    std::vector<Action> m_actions;          // All recorded turns, back to back
+    std::vector<uint32_t> m_turnEnds;       // End of each turn's run in m_actions
+    std::vector<CoreState> m_checkpoints;   // Start of turn m_firstTurn + i * CHECKPOINT_INTERVAL
+};
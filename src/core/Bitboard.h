@@ -0,0 +1,182 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "Position.h"
+
+// Geometry of the diamond board: cells with |x| + |y| <= BOARD_RADIUS,
+// numbered densely row by row (y ascending, then x ascending).
+constexpr int BOARD_RADIUS = 8;
+constexpr int BOARD_CELL_COUNT = 2 * BOARD_RADIUS * (BOARD_RADIUS + 1) + 1;
+constexpr int NO_CELL = -1;
+
+constexpr int absInt(int value) { return value < 0 ? -value : value; }
+
+constexpr bool isBoardCell(int x, int y) { return absInt(x) + absInt(y) <= BOARD_RADIUS; }
+
+constexpr int cellIndex(int x, int y) {
+    if (!isBoardCell(x, y)) {
+        return NO_CELL;
+    }
+    int rowStart = y <= 0 ? (y + BOARD_RADIUS) * (y + BOARD_RADIUS)
+                          : BOARD_CELL_COUNT - (BOARD_RADIUS - y + 1) * (BOARD_RADIUS - y + 1);
+    return rowStart + x + BOARD_RADIUS - absInt(y);
+}
+
+constexpr int cellIndex(const Position& pos) { return cellIndex(pos.x, pos.y); }
+
+// One bit per board cell. Bits past BOARD_CELL_COUNT are always zero.
+struct Bitboard {
+    static constexpr int WORDS = (BOARD_CELL_COUNT + 63) / 64;
+
+    uint64_t words[WORDS];
+
+    constexpr Bitboard() : words{} {}
+
+    static constexpr Bitboard cell(int index) {
+        Bitboard board;
+        board.set(index);
+        return board;
+    }
+
+    // Every board cell
+    static constexpr Bitboard all() {
+        Bitboard board;
+        for (int i = 0; i < BOARD_CELL_COUNT; ++i) {
+            board.set(i);
+        }
+        return board;
+    }
+
+    constexpr void set(int index) { words[index >> 6] |= uint64_t(1) << (index & 63); }
+    constexpr void reset(int index) { words[index >> 6] &= ~(uint64_t(1) << (index & 63)); }
+    constexpr bool test(int index) const { return (words[index >> 6] >> (index & 63)) & 1; }
+
+    constexpr bool any() const {
+        for (int i = 0; i < WORDS; ++i) {
+            if (words[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int count() const {
+        int total = 0;
+        for (int i = 0; i < WORDS; ++i) {
+            total += __builtin_popcountll(words[i]);
+        }
+        return total;
+    }
+
+    // Lowest set cell index, or NO_CELL when empty
+    int first() const {
+        for (int i = 0; i < WORDS; ++i) {
+            if (words[i]) {
+                return i * 64 + __builtin_ctzll(words[i]);
+            }
+        }
+        return NO_CELL;
+    }
+
+    // Calls fn(cellIndex) for every set cell, in ascending order
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (int i = 0; i < WORDS; ++i) {
+            for (uint64_t bits = words[i]; bits; bits &= bits - 1) {
+                fn(i * 64 + __builtin_ctzll(bits));
+            }
+        }
+    }
+
+    constexpr Bitboard& operator|=(const Bitboard& other) {
+        for (int i = 0; i < WORDS; ++i) {
+            words[i] |= other.words[i];
+        }
+        return *this;
+    }
+
+    constexpr Bitboard& operator&=(const Bitboard& other) {
+        for (int i = 0; i < WORDS; ++i) {
+            words[i] &= other.words[i];
+        }
+        return *this;
+    }
+
+    // Cells set here but not in other
+    constexpr Bitboard without(const Bitboard& other) const {
+        Bitboard result = *this;
+        for (int i = 0; i < WORDS; ++i) {
+            result.words[i] &= ~other.words[i];
+        }
+        return result;
+    }
+
+    constexpr Bitboard operator|(const Bitboard& other) const { Bitboard result = *this; return result |= other; }
+    constexpr Bitboard operator&(const Bitboard& other) const { Bitboard result = *this; return result &= other; }
+
+    constexpr bool operator==(const Bitboard& other) const {
+        for (int i = 0; i < WORDS; ++i) {
+            if (words[i] != other.words[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool operator!=(const Bitboard& other) const { return !(*this == other); }
+};
+
+using CellMasks = std::array<Bitboard, BOARD_CELL_COUNT>;
+
+// Builds, for every cell, the mask of board cells at offsets (dx, dy) with
+// 0 < distance(dx, dy) <= range, distance being Chebyshev or Manhattan.
+constexpr CellMasks buildCellMasks(int range, bool manhattan) {
+    CellMasks masks{};
+    for (int y = -BOARD_RADIUS; y <= BOARD_RADIUS; ++y) {
+        for (int x = -BOARD_RADIUS; x <= BOARD_RADIUS; ++x) {
+            int from = cellIndex(x, y);
+            if (from == NO_CELL) {
+                continue;
+            }
+            for (int dy = -range; dy <= range; ++dy) {
+                for (int dx = -range; dx <= range; ++dx) {
+                    int adx = absInt(dx);
+                    int ady = absInt(dy);
+                    int distance = manhattan ? adx + ady : (adx > ady ? adx : ady);
+                    int to = cellIndex(x + dx, y + dy);
+                    if (distance > 0 && distance <= range && to != NO_CELL) {
+                        masks[from].set(to);
+                    }
+                }
+            }
+        }
+    }
+    return masks;
+}
+
+// Cells each unit kind can attack from a given cell (UnitStore::canAttack)
+// and the cells a unit can step to in one move
+inline constexpr CellMasks INFANTRY_ATTACK_MASKS = buildCellMasks(1, false);
+inline constexpr CellMasks LONG_RANGE_ATTACK_MASKS = buildCellMasks(3, true);
+inline constexpr CellMasks MOVE_MASKS = buildCellMasks(1, false);
+
+// Board position of every cell index
+struct CellPositions {
+    Position cells[BOARD_CELL_COUNT];
+
+    constexpr CellPositions() : cells() {
+        for (int y = -BOARD_RADIUS; y <= BOARD_RADIUS; ++y) {
+            for (int x = -BOARD_RADIUS; x <= BOARD_RADIUS; ++x) {
+                int index = cellIndex(x, y);
+                if (index != NO_CELL) {
+                    cells[index] = Position(x, y);
+                }
+            }
+        }
+    }
+};
+
+inline constexpr CellPositions CELL_POSITIONS{};
+
+constexpr Position cellPosition(int index) { return CELL_POSITIONS.cells[index]; }
@@ -0,0 +1,238 @@
+#include "Board.h"
+
+namespace {
+
+// Board entities index infantry from 0, after the long range unit
+int viewIndex(size_t unitIndex) {
+    return unitIndex < FIRST_INFANTRY_INDEX ? 0 : static_cast<int>(unitIndex - FIRST_INFANTRY_INDEX);
+}
+
+} // namespace
+
+Board::Board() {
+    m_cells.fill(NONE);
+    m_longRangeEntity.fill(NONE);
+}
+
+void Board::update(const std::array<Player, MAX_PLAYERS>& players, uint32_t stateVersion) {
+    if (layoutChanged(players)) {
+        rebuild(players);
+        return;
+    }
+
+    int entity = 0;
+    for (const auto& player : players) {
+        int owner = player.getId();
+        for (const auto& node : player.getNodes()) {
+            if (node.getVersion() == stateVersion) {
+                refresh(entity, node.getPosition(), owner, static_cast<BoardView::Kind>(node.getType()), 0, true);
+            }
+            entity++;
+        }
+
+        const auto& units = player.getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            if (units.getVersion(i) == stateVersion) {
+                refresh(entity, units.getPosition(i), owner, BoardView::getUnitKind(units.getKind(i)), viewIndex(i),
+                        units.getCount(i) > 0);
+            }
+            entity++;
+        }
+    }
+}
+
+bool Board::layoutChanged(const std::array<Player, MAX_PLAYERS>& players) const {
+    int entity = 0;
+    for (size_t i = 0; i < players.size(); ++i) {
+        entity += static_cast<int>(players[i].getNodes().size());
+        if (m_longRangeEntity[i] != entity) {
+            return true;
+        }
+        entity += static_cast<int>(players[i].getUnits().size());
+    }
+    return entity != getEntityCount();
+}
+
+void Board::rebuild(const std::array<Player, MAX_PLAYERS>& players) {
+    m_cells.fill(NONE);
+    m_entities.clear();
+    m_longRangeEntity.fill(NONE);
+    m_occupancy.fill(Bitboard());
+
+    for (size_t p = 0; p < players.size(); ++p) {
+        const Player& player = players[p];
+        int owner = player.getId();
+        for (const auto& node : player.getNodes()) {
+            place(node.getPosition(), owner, static_cast<BoardView::Kind>(node.getType()), 0, true);
+        }
+
+        // The long range unit is first in the store
+        m_longRangeEntity[p] = getEntityCount();
+        const auto& units = player.getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            place(units.getPosition(i), owner, BoardView::getUnitKind(units.getKind(i)), viewIndex(i), units.getCount(i) > 0);
+        }
+    }
+}
+
+void Board::place(const Position& pos, int owner, BoardView::Kind kind, int index, bool alive) {
+    Entity entity;
+    entity.position = pos;
+    entity.owner = static_cast<int8_t>(owner);
+    entity.kind = static_cast<uint8_t>(kind);
+    entity.index = static_cast<uint16_t>(index);
+    entity.next = NONE;
+    entity.alive = alive;
+    m_entities.push_back(entity);
+    link(getEntityCount() - 1);
+}
+
+void Board::refresh(int entity, const Position& pos, int owner, BoardView::Kind kind, int index, bool alive) {
+    Entity& e = m_entities[entity];
+    e.owner = static_cast<int8_t>(owner);
+    e.kind = static_cast<uint8_t>(kind);
+    e.index = static_cast<uint16_t>(index);
+    if (e.position != pos || e.alive != alive) {
+        unlink(entity);
+        e.position = pos;
+        e.alive = alive;
+        link(entity);
+    }
+}
+
+// Entities off the board or dead are kept (ids stay aligned with BoardView)
+// but never linked
+void Board::link(int entity) {
+    Entity& e = m_entities[entity];
+    int cell = e.alive ? cellIndex(e.position) : NONE;
+    if (cell != NONE) {
+        e.next = m_cells[cell];
+        m_cells[cell] = static_cast<int16_t>(entity);
+        if (e.owner >= 0 && e.owner < static_cast<int>(m_occupancy.size())) {
+            m_occupancy[e.owner].set(cell);
+        }
+    }
+}
+
+void Board::unlink(int entity) {
+    int cell = m_entities[entity].alive ? cellIndex(m_entities[entity].position) : NONE;
+    if (cell == NONE) {
+        return;
+    }
+    int16_t* link = &m_cells[cell];
+    while (*link != NONE && *link != entity) {
+        link = &m_entities[*link].next;
+    }
+    if (*link == entity) {
+        *link = m_entities[entity].next;
+    }
+    m_entities[entity].next = NONE;
+
+    // Clear the owner's bit unless another of its entities shares the cell
+    int owner = m_entities[entity].owner;
+    if (owner < 0 || owner >= static_cast<int>(m_occupancy.size())) {
+        return;
+    }
+    for (int other = m_cells[cell]; other != NONE; other = m_entities[other].next) {
+        if (m_entities[other].owner == owner) {
+            return;
+        }
+    }
+    m_occupancy[owner].reset(cell);
+}
+
+int Board::getFirstAt(const Position& pos) const {
+    int cell = cellIndex(pos);
+    return cell == NONE ? NONE : m_cells[cell];
+}
+
+int Board::findNodeAt(const Position& pos, int owner) const {
+    for (int entity = getFirstAt(pos); entity != NONE; entity = getNextAt(entity)) {
+        const Entity& e = m_entities[entity];
+        if (e.owner == owner && e.kind <= BoardView::KIND_RD) {
+            return entity;
+        }
+    }
+    return NONE;
+}
+
+int Board::findUnit(int owner, BoardView::Kind kind, int index) const {
+    if (owner < 0 || owner >= static_cast<int>(m_longRangeEntity.size()) || m_longRangeEntity[owner] == NONE) {
+        return NONE;
+    }
+
+    int longRange = m_longRangeEntity[owner];
+    if (kind == BoardView::KIND_LONG_RANGE) {
+        return longRange;
+    }
+    if (kind != BoardView::KIND_INFANTRY || index < 0) {
+        return NONE;
+    }
+
+    // Infantry groups directly follow their owner's long range unit
+    int entity = longRange + 1 + index;
+    if (entity >= getEntityCount() || m_entities[entity].owner != owner ||
+        m_entities[entity].kind != BoardView::KIND_INFANTRY) {
+        return NONE;
+    }
+    return entity;
+}
+
+void Board::findEnemiesInRange(int entity, std::vector<int>& out) const {
+    out.clear();
+    if (entity < 0 || entity >= getEntityCount()) {
+        return;
+    }
+
+    // Only visit cells in reach that hold something the attacker does not own
+    int owner = m_entities[entity].owner;
+    bool twoSided = owner >= 0 && owner < static_cast<int>(m_occupancy.size());
+    Bitboard candidates = getAttackMask(entity) & (twoSided ? m_occupancy[1 - owner] : getOccupancy());
+
+    candidates.forEach([&](int cell) {
+        for (int other = m_cells[cell]; other != NONE; other = m_entities[other].next) {
+            if (m_entities[other].owner != owner) {
+                out.push_back(other);
+            }
+        }
+    });
+}
+
+Bitboard Board::getAttackMask(int entity) const {
+    const Entity& e = m_entities[entity];
+    int cell = e.alive ? cellIndex(e.position) : NONE;
+    if (cell == NONE) {
+        return Bitboard();
+    }
+    if (e.kind == BoardView::KIND_INFANTRY) {
+        return INFANTRY_ATTACK_MASKS[cell];
+    }
+    if (e.kind == BoardView::KIND_LONG_RANGE) {
+        return LONG_RANGE_ATTACK_MASKS[cell];
+    }
+    return Bitboard(); // Nodes do not attack
+}
+
+Bitboard Board::getThreats(int owner) const {
+    Bitboard threats;
+    int longRange = findUnit(owner, BoardView::KIND_LONG_RANGE, 0);
+    if (longRange == NONE) {
+        return threats;
+    }
+
+    // The long range unit is followed by the owner's infantry groups
+    for (int entity = longRange; entity < getEntityCount() && m_entities[entity].owner == owner &&
+         m_entities[entity].kind >= BoardView::KIND_INFANTRY; ++entity) {
+        threats |= getAttackMask(entity);
+    }
+    return threats;
+}
+
+Bitboard Board::getMoveTargets(int entity) const {
+    const Entity& e = m_entities[entity];
+    int cell = e.alive ? cellIndex(e.position) : NONE;
+    if (cell == NONE || e.kind <= BoardView::KIND_RD) {
+        return Bitboard();
+    }
+    return MOVE_MASKS[cell].without(getOccupancy());
+}
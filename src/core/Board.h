@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Bitboard.h"
+#include "BoardView.h"
+#include "CoreState.h"
+#include "Position.h"
+
+// Spatial index over the diamond board (cells with |x| + |y| <= RADIUS).
+// Every node and unit is an entity, numbered in the same order as BoardView
+// (per player: nodes, long range unit, infantry groups). Each cell holds the
+// head of an intrusive list of the entities standing on it, and per-player
+// occupancy bitboards are kept alongside, so occupancy and range queries
+// never scan the players. Units with no count left keep their entity id but
+// are not linked: they occupy nothing and attack nothing.
+class Board {
+public:
+    static constexpr int RADIUS = BOARD_RADIUS;
+    static constexpr int CELL_COUNT = BOARD_CELL_COUNT;
+    static constexpr int NONE = -1;
+
+    struct Entity {
+        Position position;
+        int8_t owner;
+        uint8_t kind;       // BoardView::Kind
+        uint16_t index;     // Infantry group index; 0 for nodes and long range
+        int16_t next;       // Next entity on the same cell, or NONE
+        bool alive;         // Linked into its cell; false for dead units
+    };
+
+    Board();
+
+    static bool isValid(const Position& pos) { return isBoardCell(pos.x, pos.y); }
+
+    // Dense index of a cell (see Bitboard.h); NONE when off the board
+    static int cellIndex(const Position& pos) { return ::cellIndex(pos); }
+
+    // Re-index after a commit. Only entities stamped with stateVersion can
+    // have moved, so the rest stay linked unless the entity layout changed.
+    // Player ids must match their index in players.
+    void update(const std::array<Player, MAX_PLAYERS>& players, uint32_t stateVersion);
+
+    int getEntityCount() const { return static_cast<int>(m_entities.size()); }
+    const Entity& getEntity(int entity) const { return m_entities[entity]; }
+
+    // Occupants of a cell: iterate with getNextAt until NONE
+    int getFirstAt(const Position& pos) const;
+    int getNextAt(int entity) const { return m_entities[entity].next; }
+    bool isOccupied(const Position& pos) const { return getFirstAt(pos) != NONE; }
+
+    // Entity id of a node owned by `owner` at pos, or NONE
+    int findNodeAt(const Position& pos, int owner) const;
+
+    // Entity id of a unit (KIND_INFANTRY with its group index, or
+    // KIND_LONG_RANGE), or NONE if it does not exist
+    int findUnit(int owner, BoardView::Kind kind, int index) const;
+
+    // Enemy entities the given unit can attack, using the unit's attack
+    // pattern (infantry: adjacent incl. diagonals, long range: Manhattan 3)
+    void findEnemiesInRange(int entity, std::vector<int>& out) const;
+
+    // Cells holding at least one entity of the player (0 or 1)
+    const Bitboard& getOccupancy(int owner) const { return m_occupancy[owner]; }
+    Bitboard getOccupancy() const { return m_occupancy[0] | m_occupancy[1]; }
+
+    // Cells a unit can attack from where it stands, and cells under attack
+    // by any of the player's units
+    Bitboard getAttackMask(int entity) const;
+    Bitboard getThreats(int owner) const;
+
+    // Empty cells the unit can step to
+    Bitboard getMoveTargets(int entity) const;
+
+private:
+    std::array<int16_t, CELL_COUNT> m_cells;
+    std::vector<Entity> m_entities;
+    std::array<int, MAX_PLAYERS> m_longRangeEntity;
+    std::array<Bitboard, 2> m_occupancy;
+
+    bool layoutChanged(const std::array<Player, MAX_PLAYERS>& players) const;
+    void rebuild(const std::array<Player, MAX_PLAYERS>& players);
+    void place(const Position& pos, int owner, BoardView::Kind kind, int index, bool alive);
+    void refresh(int entity, const Position& pos, int owner, BoardView::Kind kind, int index, bool alive);
+    void link(int entity);
+    void unlink(int entity);
+};
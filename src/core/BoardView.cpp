@@ -0,0 +1,105 @@
+#include "BoardView.h"
+#include <algorithm>
+
+namespace {
+
+const int INITIAL_CAPACITY = 16;
+
+int countEntities(const std::array<Player, MAX_PLAYERS>& players) {
+    int count = 0;
+    for (const auto& player : players) {
+        count += static_cast<int>(player.getNodes().size() + player.getUnits().size());
+    }
+    return count;
+}
+
+} // namespace
+
+BoardView::BoardView()
+    : m_entityCount(0)
+    , m_capacity(0)
+{
+    reserve(INITIAL_CAPACITY);
+}
+
+void BoardView::update(const std::array<Player, MAX_PLAYERS>& players,
+                       int turn, int phase, int winner, uint32_t stateVersion) {
+    int entityCount = countEntities(players);
+    bool relayout = entityCount != m_entityCount;
+    if (entityCount > m_capacity) {
+        reserve(entityCount);
+    }
+    m_entityCount = entityCount;
+
+    m_words[HEADER_LAYOUT_VERSION] = LAYOUT_VERSION;
+    m_words[HEADER_STATE_VERSION] = static_cast<int32_t>(stateVersion);
+    m_words[HEADER_TURN] = turn;
+    m_words[HEADER_PHASE] = phase;
+    m_words[HEADER_WINNER] = winner;
+    m_words[HEADER_ENTITY_COUNT] = entityCount;
+    m_words[HEADER_CAPACITY] = m_capacity;
+
+    int entity = 0;
+    for (const auto& player : players) {
+        int owner = player.getId();
+
+        for (const auto& node : player.getNodes()) {
+            if (relayout || node.getVersion() == stateVersion) {
+                writeNode(entity, owner, node);
+            }
+            entity++;
+        }
+
+        // The long range unit comes first in the store, then infantry
+        const auto& units = player.getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            if (relayout || units.getVersion(i) == stateVersion) {
+                writeUnit(entity, owner, units, i);
+            }
+            entity++;
+        }
+    }
+}
+
+void BoardView::reserve(int entityCount) {
+    int capacity = std::max(m_capacity, INITIAL_CAPACITY);
+    while (capacity < entityCount) {
+        capacity *= 2;
+    }
+
+    // Field arrays are strided by capacity, so growing moves every field
+    std::vector<int32_t> words(HEADER_WORDS + static_cast<size_t>(FIELD_COUNT) * capacity, 0);
+    if (!m_words.empty()) {
+        std::copy(m_words.begin(), m_words.begin() + HEADER_WORDS, words.begin());
+        for (int field = 0; field < FIELD_COUNT; ++field) {
+            auto src = m_words.begin() + HEADER_WORDS + static_cast<size_t>(field) * m_capacity;
+            std::copy(src, src + m_entityCount, words.begin() + HEADER_WORDS + static_cast<size_t>(field) * capacity);
+        }
+    }
+
+    m_words.swap(words);
+    m_capacity = capacity;
+    m_words[HEADER_CAPACITY] = m_capacity;
+}
+
+void BoardView::writeNode(int entity, int owner, const Node& node) {
+    m_words[offset(FIELD_OWNER, entity)] = owner;
+    m_words[offset(FIELD_KIND, entity)] = static_cast<int32_t>(node.getType());
+    m_words[offset(FIELD_POS_X, entity)] = node.getPosition().x;
+    m_words[offset(FIELD_POS_Y, entity)] = node.getPosition().y;
+    m_words[offset(FIELD_HP, entity)] = node.getHp();
+    m_words[offset(FIELD_MAX_HP, entity)] = node.getMaxHp();
+    m_words[offset(FIELD_COUNT_UNITS, entity)] = 0;
+    m_words[offset(FIELD_FLAGS, entity)] = node.isDefended() ? FLAG_DEFENDED : 0;
+}
+
+void BoardView::writeUnit(int entity, int owner, const UnitStore& units, size_t index) {
+    m_words[offset(FIELD_OWNER, entity)] = owner;
+    m_words[offset(FIELD_KIND, entity)] = getUnitKind(units.getKind(index));
+    m_words[offset(FIELD_POS_X, entity)] = units.getPosition(index).x;
+    m_words[offset(FIELD_POS_Y, entity)] = units.getPosition(index).y;
+    m_words[offset(FIELD_HP, entity)] = units.getHp(index);
+    m_words[offset(FIELD_MAX_HP, entity)] = units.getMaxHp(index);
+    m_words[offset(FIELD_COUNT_UNITS, entity)] = units.getCount(index);
+    m_words[offset(FIELD_FLAGS, entity)] = 0;
+}
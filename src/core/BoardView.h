@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CoreState.h"
+
+// Packed struct-of-arrays mirror of node and unit state, laid out as int32
+// words so JavaScript can read it through a typed array view of Wasm memory
+// without marshaling:
+//
+//   header   HEADER_WORDS words: layout version, state version, turn, phase,
+//            winner, entity count, capacity, reserved
+//   fields   FIELD_COUNT arrays of `capacity` words each, field f starting
+//            at HEADER_WORDS + f * capacity; entity i is element i of each
+//
+// Entities are listed per player: nodes, then the long range unit, then
+// infantry groups. The buffer is reallocated when the entity count exceeds
+// the capacity, so views must be re-acquired after any state change.
+class BoardView {
+public:
+    enum Header {
+        HEADER_LAYOUT_VERSION,
+        HEADER_STATE_VERSION,
+        HEADER_TURN,
+        HEADER_PHASE,
+        HEADER_WINNER,
+        HEADER_ENTITY_COUNT,
+        HEADER_CAPACITY,
+        HEADER_RESERVED,
+        HEADER_WORDS
+    };
+
+    enum Field {
+        FIELD_OWNER,
+        FIELD_KIND,
+        FIELD_POS_X,
+        FIELD_POS_Y,
+        FIELD_HP,
+        FIELD_MAX_HP,
+        FIELD_COUNT_UNITS,
+        FIELD_FLAGS,
+        FIELD_COUNT
+    };
+
+    // Values of FIELD_KIND; nodes use their NodeType value
+    enum Kind {
+        KIND_CORE = 0,
+        KIND_COMMS = 1,
+        KIND_RD = 2,
+        KIND_INFANTRY = 3,
+        KIND_LONG_RANGE = 4
+    };
+
+    static Kind getUnitKind(UnitKind kind) { return kind == UnitKind::LONG_RANGE ? KIND_LONG_RANGE : KIND_INFANTRY; }
+
+    static constexpr int32_t LAYOUT_VERSION = 1;
+    static constexpr int32_t FLAG_DEFENDED = 1;
+
+    BoardView();
+
+    // Refresh the mirror after a commit. Only entities stamped with
+    // stateVersion are rewritten unless the entity layout changed.
+    void update(const std::array<Player, MAX_PLAYERS>& players,
+                int turn, int phase, int winner, uint32_t stateVersion);
+
+    const int32_t* data() const { return m_words.data(); }
+    size_t size() const { return m_words.size(); }
+    int getEntityCount() const { return m_entityCount; }
+    int getCapacity() const { return m_capacity; }
+
+    int32_t get(Field field, int entity) const { return m_words[offset(field, entity)]; }
+
+private:
+    std::vector<int32_t> m_words;
+    int m_entityCount;
+    int m_capacity;
+
+    size_t offset(Field field, int entity) const {
+        return HEADER_WORDS + static_cast<size_t>(field) * m_capacity + entity;
+    }
+
+    void reserve(int entityCount);
+    void writeNode(int entity, int owner, const Node& node);
+    void writeUnit(int entity, int owner, const UnitStore& units, size_t index);
+};
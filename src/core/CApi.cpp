@@ -0,0 +1,237 @@
+#include "CApi.h"
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GameState.h"
+#include "Trace.h"
+
+namespace {
+
+// A match plus the buffers its getters hand out
+struct Match {
+    GameState game;
+    std::string delta;
+};
+
+// Handles carry the slot (plus one, so 0 stays invalid) in the low 16 bits
+// and the slot's generation above, so a destroyed match's handle never
+// reaches the match that reuses its slot
+struct Slot {
+    std::unique_ptr<Match> match;
+    uint32_t generation = 1;
+};
+
+const uint32_t MAX_SLOTS = 0xFFFF;
+const uint32_t MAX_GENERATION = 0xFFFF;
+
+std::vector<Slot> g_slots;
+std::vector<uint32_t> g_freeSlots;
+std::string g_trace;
+
+nbd_match makeHandle(uint32_t slot) {
+    return (g_slots[slot].generation << 16) | (slot + 1);
+}
+
+Match* findMatch(nbd_match handle) {
+    uint32_t slot = (handle & 0xFFFF) - 1;
+    if ((handle & 0xFFFF) == 0 || slot >= g_slots.size() || g_slots[slot].generation != (handle >> 16)) {
+        return nullptr;
+    }
+    return g_slots[slot].match.get();
+}
+
+} // namespace
+
+nbd_match nbd_create_match(const char* player1Name, const char* player2Name) {
+    uint32_t slot;
+    if (!g_freeSlots.empty()) {
+        slot = g_freeSlots.back();
+        g_freeSlots.pop_back();
+    } else if (g_slots.size() < MAX_SLOTS) {
+        slot = static_cast<uint32_t>(g_slots.size());
+        g_slots.emplace_back();
+    } else {
+        return 0;
+    }
+
+    g_slots[slot].match = std::make_unique<Match>();
+    g_slots[slot].match->game.initializeGame(player1Name ? player1Name : "", player2Name ? player2Name : "");
+    return makeHandle(slot);
+}
+
+void nbd_destroy_match(nbd_match match) {
+    if (!findMatch(match)) {
+        return;
+    }
+    uint32_t slot = (match & 0xFFFF) - 1;
+    g_slots[slot].match.reset();
+    g_slots[slot].generation = g_slots[slot].generation < MAX_GENERATION ? g_slots[slot].generation + 1 : 1;
+    g_freeSlots.push_back(slot);
+}
+
+void* nbd_alloc(size_t size) {
+    return std::malloc(size ? size : 1);
+}
+
+void nbd_free(void* ptr) {
+    std::free(ptr);
+}
+
+int32_t nbd_submit_action(nbd_match match, int32_t playerId, int32_t actionCode, int32_t x, int32_t y) {
+    Match* m = findMatch(match);
+    if (!m) {
+        return NBD_INVALID_MATCH;
+    }
+    int32_t tuple[ACTION_TUPLE_WORDS] = { playerId, actionCode, x, y, 0 };
+    int32_t result = 0;
+    m->game.submitActions(tuple, 1, &result);
+    return result;
+}
+
+int32_t nbd_submit_turn(nbd_match match, const int32_t* tuples, int32_t count, int32_t* results) {
+    Match* m = findMatch(match);
+    if (!m || count < 0 || (count > 0 && (!tuples || !results))) {
+        return NBD_INVALID_MATCH;
+    }
+    return static_cast<int32_t>(m->game.submitActions(tuples, static_cast<size_t>(count), results));
+}
+
+int32_t nbd_end_turn(nbd_match match) {
+    Match* m = findMatch(match);
+    if (!m) {
+        return NBD_INVALID_MATCH;
+    }
+    m->game.endTurn();
+    return static_cast<int32_t>(m->game.getGamePhase());
+}
+
+int32_t nbd_get_turn(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getCurrentTurn() : NBD_INVALID_MATCH;
+}
+
+int32_t nbd_get_phase(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? static_cast<int32_t>(m->game.getGamePhase()) : NBD_INVALID_MATCH;
+}
+
+int32_t nbd_get_winner(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getWinner() : NBD_INVALID_MATCH;
+}
+
+uint32_t nbd_get_state_version(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getStateVersion() : 0;
+}
+
+const int32_t* nbd_get_board_view(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getBoardView().data() : nullptr;
+}
+
+int32_t nbd_get_board_view_size(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? static_cast<int32_t>(m->game.getBoardView().size()) : 0;
+}
+
+const char* nbd_get_state_delta(nbd_match match, uint32_t sinceVersion) {
+    Match* m = findMatch(match);
+    if (!m) {
+        return nullptr;
+    }
+    m->game.getStateDelta(sinceVersion, m->delta);
+    return m->delta.c_str();
+}
+
+int32_t nbd_get_state_delta_size(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? static_cast<int32_t>(m->delta.size()) : 0;
+}
+
+const char* nbd_get_player_state(nbd_match match, int32_t playerId) {
+    Match* m = findMatch(match);
+    if (!m || playerId < 0 || playerId >= MAX_PLAYERS) {
+        return nullptr;
+    }
+    return m->game.getPlayerState(playerId).c_str();
+}
+
+int32_t nbd_get_player_state_size(nbd_match match, int32_t playerId) {
+    Match* m = findMatch(match);
+    if (!m || playerId < 0 || playerId >= MAX_PLAYERS) {
+        return 0;
+    }
+    return static_cast<int32_t>(m->game.getPlayerState(playerId).size());
+}
+
+const uint8_t* nbd_save_snapshot(nbd_match match) {
+    Match* m = findMatch(match);
+    if (!m) {
+        return nullptr;
+    }
+    return m->game.getSnapshot().data();
+}
+
+int32_t nbd_get_snapshot_size(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? static_cast<int32_t>(m->game.getSnapshot().size()) : 0;
+}
+
+const char* nbd_get_state(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getStateJson().c_str() : nullptr;
+}
+
+int32_t nbd_get_state_size(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? static_cast<int32_t>(m->game.getStateJson().size()) : 0;
+}
+
+int32_t nbd_get_metrics(nbd_match match, double* out, int32_t capacity) {
+    Match* m = findMatch(match);
+    if (!m) {
+        return NBD_INVALID_MATCH;
+    }
+    Metrics::Array metrics;
+    m->game.getMetrics(metrics);
+    for (int32_t i = 0; out && i < capacity && i < static_cast<int32_t>(metrics.size()); ++i) {
+        out[i] = metrics[i];
+    }
+    return static_cast<int32_t>(metrics.size());
+}
+
+uint32_t nbd_get_cache_hits(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getStateCacheStats().hits : 0;
+}
+
+uint32_t nbd_get_cache_misses(nbd_match match) {
+    Match* m = findMatch(match);
+    return m ? m->game.getStateCacheStats().misses : 0;
+}
+
+int32_t nbd_load_snapshot(nbd_match match, const uint8_t* data, int32_t size) {
+    Match* m = findMatch(match);
+    if (!m) {
+        return NBD_INVALID_MATCH;
+    }
+    if (!data || size < 0) {
+        return 0;
+    }
+    return m->game.loadSnapshot(data, static_cast<size_t>(size)) ? 1 : 0;
+}
+
+const char* nbd_get_trace() {
+    Trace::writeJson(g_trace);
+    return g_trace.c_str();
+}
+
+int32_t nbd_get_trace_size() {
+    return static_cast<int32_t>(g_trace.size());
+}
+
+void nbd_clear_trace() {
+    Trace::clear();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/emscripten.h>
+#define NBD_EXPORT EMSCRIPTEN_KEEPALIVE
+#else
+#define NBD_EXPORT
+#endif
+
+// Plain C ABI over the game core, for callers that do not want Embind. Every
+// argument and result is an integer or a pointer into Wasm memory, so a call
+// costs no wrapper objects and no string conversion.
+//
+// Matches are addressed by handle (0 is never valid). Pointers returned by
+// the getters point into buffers owned by the match; they stay valid until
+// the next call on that match, or until Wasm memory grows.
+//
+// Calls on an unknown or destroyed match return NBD_INVALID_MATCH from
+// nbd_submit_action, nbd_submit_turn, nbd_end_turn, nbd_get_turn,
+// nbd_get_phase, nbd_get_winner, nbd_get_metrics and nbd_load_snapshot;
+// INT32_MIN is never a valid result of any of them (a winner of -1 means
+// the match is still running). Pointer getters return null and size and
+// counter getters return 0 instead.
+//
+// Action codes are ActionType values and result codes SubmitResult values
+// (Action.h); nbd_submit_turn takes ACTION_TUPLE_WORDS int32s per action.
+
+typedef uint32_t nbd_match;
+
+#define NBD_INVALID_MATCH INT32_MIN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Lifecycle. Names are NUL-terminated UTF-8; returns 0 when out of slots.
+NBD_EXPORT nbd_match nbd_create_match(const char* player1Name, const char* player2Name);
+NBD_EXPORT void nbd_destroy_match(nbd_match match);
+
+// Buffers for passing tuples and snapshots in
+NBD_EXPORT void* nbd_alloc(size_t size);
+NBD_EXPORT void nbd_free(void* ptr);
+
+// Turn flow. submit returns a SubmitResult; submit_turn writes one per tuple
+// to results and returns how many were accepted (NBD_INVALID_MATCH also
+// for a negative count or missing buffers); end_turn returns the GamePhase
+// afterwards.
+NBD_EXPORT int32_t nbd_submit_action(nbd_match match, int32_t playerId, int32_t actionCode, int32_t x, int32_t y);
+NBD_EXPORT int32_t nbd_submit_turn(nbd_match match, const int32_t* tuples, int32_t count, int32_t* results);
+NBD_EXPORT int32_t nbd_end_turn(nbd_match match);
+
+NBD_EXPORT int32_t nbd_get_turn(nbd_match match);
+NBD_EXPORT int32_t nbd_get_phase(nbd_match match);
+NBD_EXPORT int32_t nbd_get_winner(nbd_match match);
+NBD_EXPORT uint32_t nbd_get_state_version(nbd_match match);
+
+// State pointers. The board view is the packed Int32 layout of BoardView.h;
+// sizes are in int32 words for the view and bytes otherwise.
+NBD_EXPORT const int32_t* nbd_get_board_view(nbd_match match);
+NBD_EXPORT int32_t nbd_get_board_view_size(nbd_match match);
+
+// Compact JSON of the changes after sinceVersion (see GameState::getStateDelta),
+// NUL-terminated; the length excludes the terminator
+NBD_EXPORT const char* nbd_get_state_delta(nbd_match match, uint32_t sinceVersion);
+NBD_EXPORT int32_t nbd_get_state_delta_size(nbd_match match);
+
+// Compact JSON of the state as playerId sees it under fog of war (see
+// GameState::getPlayerState), NUL-terminated; valid until the next call for
+// the same player. Null for an unknown match or player.
+NBD_EXPORT const char* nbd_get_player_state(nbd_match match, int32_t playerId);
+NBD_EXPORT int32_t nbd_get_player_state_size(nbd_match match, int32_t playerId);
+
+// Compact JSON of the full state, NUL-terminated. This and the snapshot are
+// served from the match's serialization cache: re-encoded only after the
+// state changes, and valid until then.
+NBD_EXPORT const char* nbd_get_state(nbd_match match);
+NBD_EXPORT int32_t nbd_get_state_size(nbd_match match);
+
+NBD_EXPORT const uint8_t* nbd_save_snapshot(nbd_match match);
+NBD_EXPORT int32_t nbd_get_snapshot_size(nbd_match match);
+// Returns 1 when loaded, 0 when the snapshot was rejected
+NBD_EXPORT int32_t nbd_load_snapshot(nbd_match match, const uint8_t* data, int32_t size);
+
+// Copies up to capacity words of the runtime counters (layout in Metrics.h)
+// to out and returns Metrics::WORD_COUNT, or NBD_INVALID_MATCH
+NBD_EXPORT int32_t nbd_get_metrics(nbd_match match, double* out, int32_t capacity);
+
+// Serialization cache lookups that were served as is, and that re-encoded
+NBD_EXPORT uint32_t nbd_get_cache_hits(nbd_match match);
+NBD_EXPORT uint32_t nbd_get_cache_misses(nbd_match match);
+
+// Chrome trace-event JSON of the spans recorded so far (see Trace.h),
+// NUL-terminated and valid until the next call; empty unless built with
+// TRACE=1
+NBD_EXPORT const char* nbd_get_trace(void);
+NBD_EXPORT int32_t nbd_get_trace_size(void);
+NBD_EXPORT void nbd_clear_trace(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,164 @@
+#include "CombatKernel.h"
+#include <algorithm>
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+CombatKernel::CombatKernel(std::pmr::memory_resource* memory)
+    : m_attackerX(memory)
+    , m_attackerY(memory)
+    , m_attackerOwner(memory)
+    , m_attackerRef(memory)
+    , m_attackerManhattan(memory)
+    , m_attackerChebyshev(memory)
+    , m_damageVsInfantry(memory)
+    , m_damageVsCore(memory)
+    , m_damageVsOther(memory)
+    , m_targetX(memory)
+    , m_targetY(memory)
+    , m_targetOwner(memory)
+    , m_targetType(memory)
+    , m_targetRef(memory)
+    , m_damage(memory)
+{
+}
+
+void CombatKernel::clear() {
+    m_attackerX.clear();
+    m_attackerY.clear();
+    m_attackerOwner.clear();
+    m_attackerRef.clear();
+    m_attackerManhattan.clear();
+    m_attackerChebyshev.clear();
+    m_damageVsInfantry.clear();
+    m_damageVsCore.clear();
+    m_damageVsOther.clear();
+
+    m_targetX.clear();
+    m_targetY.clear();
+    m_targetOwner.clear();
+    m_targetType.clear();
+    m_targetRef.clear();
+    m_damage.clear();
+}
+
+void CombatKernel::addAttacker(int owner, UnitKind kind, const Position& position, int count, int32_t ref) {
+    if (count <= 0) {
+        return;
+    }
+    for (size_t a = 0; a < m_attackerRef.size(); ++a) {
+        if (m_attackerOwner[a] == owner && m_attackerRef[a] == ref) {
+            return;
+        }
+    }
+
+    AttackReach reach = getAttackReach(kind);
+    m_attackerX.push_back(position.x);
+    m_attackerY.push_back(position.y);
+    m_attackerOwner.push_back(owner);
+    m_attackerRef.push_back(ref);
+    m_attackerManhattan.push_back(reach.manhattan);
+    m_attackerChebyshev.push_back(reach.chebyshev);
+    // Every other target type shares the COMMS rule
+    m_damageVsInfantry.push_back(calculateAttackDamage(kind, count, TargetType::INFANTRY));
+    m_damageVsCore.push_back(calculateAttackDamage(kind, count, TargetType::CORE));
+    m_damageVsOther.push_back(calculateAttackDamage(kind, count, TargetType::COMMS));
+}
+
+size_t CombatKernel::addTarget(int owner, TargetType type, const Position& position, int32_t ref) {
+    for (size_t t = 0; t < m_targetRef.size(); ++t) {
+        if (m_targetOwner[t] == owner && m_targetType[t] == static_cast<int32_t>(type) && m_targetRef[t] == ref) {
+            return t;
+        }
+    }
+
+    m_targetX.push_back(position.x);
+    m_targetY.push_back(position.y);
+    m_targetOwner.push_back(owner);
+    m_targetType.push_back(static_cast<int32_t>(type));
+    m_targetRef.push_back(ref);
+    m_damage.push_back(0);
+    return m_targetRef.size() - 1;
+}
+
+void CombatKernel::resolve() {
+    std::fill(m_damage.begin(), m_damage.end(), 0);
+    size_t targets = getTargetCount();
+    for (size_t a = 0; a < getAttackerCount(); ++a) {
+        size_t done = accumulateSimd(a, 0, targets);
+        accumulateScalar(a, done, targets);
+    }
+}
+
+#ifdef __wasm_simd128__
+
+size_t CombatKernel::accumulateSimd(size_t a, size_t first, size_t end) {
+    const v128_t x = wasm_i32x4_splat(m_attackerX[a]);
+    const v128_t y = wasm_i32x4_splat(m_attackerY[a]);
+    const v128_t owner = wasm_i32x4_splat(m_attackerOwner[a]);
+    const v128_t manhattan = wasm_i32x4_splat(m_attackerManhattan[a]);
+    const v128_t chebyshev = wasm_i32x4_splat(m_attackerChebyshev[a]);
+    const v128_t vsInfantry = wasm_i32x4_splat(m_damageVsInfantry[a]);
+    const v128_t vsCore = wasm_i32x4_splat(m_damageVsCore[a]);
+    const v128_t vsOther = wasm_i32x4_splat(m_damageVsOther[a]);
+    const v128_t infantryType = wasm_i32x4_splat(static_cast<int32_t>(TargetType::INFANTRY));
+    const v128_t coreType = wasm_i32x4_splat(static_cast<int32_t>(TargetType::CORE));
+    const v128_t zero = wasm_i32x4_splat(0);
+
+    size_t t = first;
+    for (; t + 4 <= end; t += 4) {
+        v128_t dx = wasm_i32x4_abs(wasm_i32x4_sub(wasm_v128_load(&m_targetX[t]), x));
+        v128_t dy = wasm_i32x4_abs(wasm_i32x4_sub(wasm_v128_load(&m_targetY[t]), y));
+        v128_t inRange = wasm_v128_and(wasm_i32x4_le(wasm_i32x4_add(dx, dy), manhattan),
+                                       wasm_i32x4_le(wasm_i32x4_max(dx, dy), chebyshev));
+        inRange = wasm_v128_and(inRange, wasm_i32x4_ne(wasm_v128_or(dx, dy), zero));
+        inRange = wasm_v128_and(inRange, wasm_i32x4_ne(wasm_v128_load(&m_targetOwner[t]), owner));
+
+        v128_t type = wasm_v128_load(&m_targetType[t]);
+        v128_t damage = wasm_v128_bitselect(vsCore, vsOther, wasm_i32x4_eq(type, coreType));
+        damage = wasm_v128_bitselect(vsInfantry, damage, wasm_i32x4_eq(type, infantryType));
+
+        v128_t total = wasm_i32x4_add(wasm_v128_load(&m_damage[t]), wasm_v128_and(damage, inRange));
+        wasm_v128_store(&m_damage[t], total);
+    }
+    return t;
+}
+
+#else
+
+size_t CombatKernel::accumulateSimd(size_t /*a*/, size_t first, size_t /*end*/) {
+    return first;
+}
+
+#endif
+
+void CombatKernel::accumulateScalar(size_t a, size_t first, size_t end) {
+    const int32_t x = m_attackerX[a];
+    const int32_t y = m_attackerY[a];
+    const int32_t owner = m_attackerOwner[a];
+    const int32_t manhattan = m_attackerManhattan[a];
+    const int32_t chebyshev = m_attackerChebyshev[a];
+    const int32_t vsInfantry = m_damageVsInfantry[a];
+    const int32_t vsCore = m_damageVsCore[a];
+    const int32_t vsOther = m_damageVsOther[a];
+    const int32_t* targetX = m_targetX.data();
+    const int32_t* targetY = m_targetY.data();
+    const int32_t* targetOwner = m_targetOwner.data();
+    const int32_t* targetType = m_targetType.data();
+    int32_t* damage = m_damage.data();
+
+    // Branch-free; the selects compile to conditional moves
+    for (size_t t = first; t < end; ++t) {
+        int32_t dx = targetX[t] - x;
+        int32_t dy = targetY[t] - y;
+        dx = dx < 0 ? -dx : dx;
+        dy = dy < 0 ? -dy : dy;
+        int32_t inRange = (dx + dy <= manhattan) & ((dx > dy ? dx : dy) <= chebyshev) &
+                          ((dx | dy) != 0) & (targetOwner[t] != owner);
+        int32_t type = targetType[t];
+        int32_t amount = type == static_cast<int32_t>(TargetType::INFANTRY) ? vsInfantry
+                       : type == static_cast<int32_t>(TargetType::CORE) ? vsCore : vsOther;
+        damage[t] += amount & -inRange;
+    }
+}
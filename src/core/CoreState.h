@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "Action.h"
+#include "FixedVector.h"
+#include "Player.h"
+
+enum class GamePhase {
+    PLANNING,
+    EXECUTING,
+    GAME_OVER
+};
+
+const int MAX_PLAYERS = 2;
+
+// Each player has their own share of the turn's action queue, so one player
+// filling theirs never stops the other from acting
+const std::size_t MAX_PENDING_ACTIONS_PER_PLAYER = 16;
+const std::size_t MAX_PENDING_ACTIONS = MAX_PENDING_ACTIONS_PER_PLAYER * MAX_PLAYERS;
+
+using ActionQueue = FixedVector<Action, MAX_PENDING_ACTIONS>;
+
+// Everything turn resolution reads or writes, in one pointer-free block:
+// copying a CoreState is a single memcpy, which is what GameState::clone and
+// GameState::restore rely on. Player names, the event log and the derived
+// views (BoardView, Board) live outside it in GameState.
+struct CoreState {
+    int currentTurn = 1;
+    GamePhase phase = GamePhase::PLANNING;
+    int winner = -1; // -1 = no winner, 0 = player 1, 1 = player 2
+    std::array<Player, MAX_PLAYERS> players = { Player(0), Player(1) };
+    ActionQueue pendingActions;
+};
+
+static_assert(std::is_trivially_copyable<CoreState>::value, "CoreState must stay memcpy-able");
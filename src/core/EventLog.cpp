@@ -0,0 +1,45 @@
+#include "EventLog.h"
+
+EventLog::EventLog()
+    : m_events()
+    , m_begin(0)
+    , m_end(0)
+{
+}
+
+void EventLog::clear(uint32_t firstSequence) {
+    m_begin = firstSequence;
+    m_end = firstSequence;
+}
+
+const GameEvent& EventLog::append(const GameEvent& event) {
+    GameEvent& slot = m_events[m_end % CAPACITY];
+    slot = event;
+    slot.sequence = m_end;
+    m_end++;
+    if (m_end - m_begin > CAPACITY) {
+        m_begin++;
+    }
+    return slot;
+}
+
+uint32_t EventLog::findFirstAfterVersion(uint32_t sinceVersion) const {
+    // Versions never decrease along the log, so binary search the window
+    uint32_t low = m_begin;
+    uint32_t high = m_end;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (at(mid).version > sinceVersion) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+void EventLog::setAllVersions(uint32_t version) {
+    for (uint32_t sequence = m_begin; sequence < m_end; ++sequence) {
+        m_events[sequence % CAPACITY].version = version;
+    }
+}
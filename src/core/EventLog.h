@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Kinds of game log entries. The human-readable text for each code is
+// produced by GameState::formatEvent only when a client asks for it.
+enum class EventCode : uint8_t {
+    GAME_STARTED,           // "Game started: <p0> vs <p1>"
+    SUBMIT_WRONG_PHASE,     // "Cannot submit action: not in planning phase"
+    INVALID_PLAYER,         // "Invalid player ID"
+    INVALID_ACTION,         // "Invalid action: <detail = ActionType>"
+    ACTION_SUBMITTED,       // "<actor> submitted action: <detail = ActionType>"
+    PROCESS_WRONG_PHASE,    // "Cannot process actions: not in planning phase"
+    UNIT_MOVED,             // "<actor> moved a unit"
+    ATTACKED,               // "<actor> attacked <target>"
+    ATTACK_FAILED,          // "<actor> tried to attack but R&D Lab is down"
+    HACKED,                 // "<actor> hacked <target>'s <detail = NodeType>"
+    HACK_FAILED,            // "<actor> tried to hack but lacked resources"
+    DEFENDED,               // "<actor> defended their <detail = NodeType>"
+    SPIED,                  // "<actor> used spy and gained <amount> IP"
+    SPY_FAILED,             // "<actor> tried to spy but Comms is down"
+    GAME_OVER,              // "Game over: <actor> wins!"
+    STATE_RESTORED,         // "Game state restored"
+    COUNT
+};
+
+// Compact, trivially copyable log entry
+struct GameEvent {
+    uint32_t sequence;  // Position in the match's log, counting evicted entries
+    uint32_t version;   // State version the entry was published in
+    int32_t amount;
+    uint16_t turn;
+    EventCode code;
+    int8_t actor;       // Player id, or -1
+    int8_t target;      // Player id, or -1
+    uint8_t detail;     // ActionType or NodeType, depending on code
+};
+
+// Fixed-capacity ring buffer of the most recent game events. Appending never
+// allocates; once full, the oldest entry is overwritten. Entries are
+// addressed by their absolute sequence number.
+class EventLog {
+public:
+    static const uint32_t CAPACITY = 512;
+
+    EventLog();
+
+    // Drop every entry; the next append gets sequence number firstSequence
+    void clear(uint32_t firstSequence = 0);
+    const GameEvent& append(const GameEvent& event);
+
+    // Retained entries are [getFirstSequence(), getEndSequence())
+    uint32_t getFirstSequence() const { return m_begin; }
+    uint32_t getEndSequence() const { return m_end; }
+    uint32_t size() const { return m_end - m_begin; }
+    bool empty() const { return m_end == m_begin; }
+
+    // Entry by absolute sequence number; must be within the retained range
+    const GameEvent& at(uint32_t sequence) const { return m_events[sequence % CAPACITY]; }
+
+    // First retained sequence whose version is newer than sinceVersion
+    uint32_t findFirstAfterVersion(uint32_t sinceVersion) const;
+
+    // Re-stamp every retained entry with the given version
+    void setAllVersions(uint32_t version);
+
+private:
+    std::array<GameEvent, CAPACITY> m_events;
+    uint32_t m_begin;
+    uint32_t m_end;
+};
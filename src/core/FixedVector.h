@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Vector-like container with inline, fixed capacity. It never allocates and
+// is trivially copyable whenever T is, so state built from it can be copied
+// with a single memcpy.
+template <typename T, std::size_t Capacity>
+class FixedVector {
+public:
+    FixedVector() : m_items(), m_size(0) {}
+
+    static constexpr std::size_t capacity() { return Capacity; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool full() const { return m_size == Capacity; }
+
+    T& operator[](std::size_t index) { return m_items[index]; }
+    const T& operator[](std::size_t index) const { return m_items[index]; }
+
+    T* begin() { return m_items; }
+    T* end() { return m_items + m_size; }
+    const T* begin() const { return m_items; }
+    const T* end() const { return m_items + m_size; }
+
+    T& back() { return m_items[m_size - 1]; }
+    const T& back() const { return m_items[m_size - 1]; }
+
+    // Returns false (and leaves the vector unchanged) when full
+    bool push_back(const T& item) {
+        if (m_size == Capacity) {
+            return false;
+        }
+        m_items[m_size++] = item;
+        return true;
+    }
+
+    // Inserts before position, shifting later items up; false when full
+    bool insert(std::size_t position, const T& item) {
+        if (m_size == Capacity || position > m_size) {
+            return false;
+        }
+        for (std::size_t i = m_size; i > position; --i) {
+            m_items[i] = m_items[i - 1];
+        }
+        m_items[position] = item;
+        m_size++;
+        return true;
+    }
+
+    void clear() { m_size = 0; }
+
+private:
+    T m_items[Capacity];
+    uint32_t m_size;
+};
@@ -1,11 +1,152 @@
 #include "GameState.h"
-#include <sstream>
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include "Snapshot.h"
+#include "Trace.h"
+#include "TurnArena.h"
+#include <algorithm>
 #include <iostream>
 
+namespace {
+
+bool readIntField(const JsonValue& object, const char* key, int& out) {
+    const JsonValue* value = object.find(key);
+    return value && value->getInt(out);
+}
+
+// Infantry groups and the long range unit share the same JSON and snapshot layout
+struct UnitRecord {
+    UnitHandle handle = INVALID_UNIT_HANDLE;
+    Position position;
+    int count = 0;
+    int hp = 0;
+    int maxHp = 0;
+};
+
+bool readUnitJson(const JsonValue& json, UnitRecord& unit) {
+    std::string id;
+    int x = 0, y = 0;
+    const JsonValue* idJson = json.find("id");
+    if (!idJson || !idJson->getString(id) ||
+        !readIntField(json, "posX", x) || !readIntField(json, "posY", y) ||
+        !readIntField(json, "count", unit.count) || !readIntField(json, "hp", unit.hp) ||
+        !readIntField(json, "maxHp", unit.maxHp)) {
+        return false;
+    }
+    unit.handle = parseUnitId(id);
+    unit.position = Position(x, y);
+    return true;
+}
+
+// Checked before the record reaches UnitStore, whose setHp would clamp an
+// HP above the maximum instead of refusing it
+bool isLegalUnitRecord(const UnitRecord& unit) {
+    return Board::isValid(unit.position) && unit.count >= 0 && unit.hp >= 0 && unit.hp <= unit.maxHp;
+}
+
+bool addInfantryRecord(Player& player, const UnitRecord& unit) {
+    if (!isLegalUnitRecord(unit)) {
+        return false;
+    }
+    UnitHandle handle = player.addInfantryGroup(unit.position, unit.count, unit.handle);
+    if (handle == INVALID_UNIT_HANDLE) {
+        return false;
+    }
+    player.updateUnitStats(handle, unit.hp, unit.maxHp);
+    return true;
+}
+
+bool setLongRangeRecord(Player& player, const UnitRecord& unit) {
+    if (!isLegalUnitRecord(unit)) {
+        return false;
+    }
+    player.setLongRangeUnit(unit.position, unit.count);
+    player.updateUnitStats(LONG_RANGE_UNIT_HANDLE, unit.hp, unit.maxHp);
+    return true;
+}
+
+size_t countActions(const ActionQueue& queue, int playerId) {
+    size_t count = 0;
+    for (const auto& action : queue) {
+        count += action.playerId == playerId;
+    }
+    return count;
+}
+
+void writeNodeJson(JsonWriter& json, const Node& node) {
+    switch (node.getType()) {
+        case NodeType::CORE: json.key("core"); break;
+        case NodeType::COMMS: json.key("comms"); break;
+        case NodeType::RD: json.key("rd"); break;
+    }
+    json.beginObject();
+    json.field("type", node.getTypeName());
+    json.field("posX", node.getPosition().x);
+    json.field("posY", node.getPosition().y);
+    json.field("hp", node.getHp());
+    json.field("maxHp", node.getMaxHp());
+    json.field("defended", node.isDefended());
+    json.endObject();
+}
+
+// Writes the fields shared by infantry groups and the long range unit; the
+// caller opens and closes the enclosing object
+void writeUnitJsonFields(JsonWriter& json, int playerId, const UnitStore& units, size_t index) {
+    json.field("id", formatUnitId(playerId, units.getKind(index) == UnitKind::LONG_RANGE, units.getHandle(index)));
+    json.field("posX", units.getPosition(index).x);
+    json.field("posY", units.getPosition(index).y);
+    json.field("count", units.getCount(index));
+    json.field("hp", units.getHp(index));
+    json.field("maxHp", units.getMaxHp(index));
+}
+
+void writeUnitSnapshot(SnapshotWriter& writer, const UnitStore& units, size_t index) {
+    writer.writeInt(static_cast<int32_t>(units.getHandle(index)));
+    writer.writeInt(units.getPosition(index).x);
+    writer.writeInt(units.getPosition(index).y);
+    writer.writeInt(units.getCount(index));
+    writer.writeInt(units.getHp(index));
+    writer.writeInt(units.getMaxHp(index));
+}
+
+bool readUnitSnapshot(SnapshotReader& reader, UnitRecord& unit) {
+    int32_t id = 0, x = 0, y = 0;
+    if (!reader.readInt(id) || !reader.readInt(x) || !reader.readInt(y) ||
+        !reader.readInt(unit.count) || !reader.readInt(unit.hp) || !reader.readInt(unit.maxHp) || id < 0) {
+        return false;
+    }
+    unit.handle = static_cast<UnitHandle>(id);
+    unit.position = Position(x, y);
+    return true;
+}
+
+// A viewer sees the match-wide entries and what they did or suffered, but
+// not the enemy's own submissions, moves, defends, spies and failures
+bool isEventShownTo(const GameEvent& event, int viewerId) {
+    if (viewerId < 0 || event.actor < 0 || event.code == EventCode::GAME_OVER) {
+        return true;
+    }
+    return event.actor == viewerId || event.target == viewerId;
+}
+
+// Formats each log entry straight into the output; viewerId -1 writes all
+void writeLogJson(JsonWriter& json, const GameState& game, uint32_t fromSequence, int viewerId = -1) {
+    const EventLog& log = game.getEventLog();
+    json.beginArray();
+    for (uint32_t sequence = fromSequence; sequence < log.getEndSequence(); ++sequence) {
+        if (isEventShownTo(log.at(sequence), viewerId)) {
+            json.valueFrom([&](std::string& out) { game.formatEvent(log.at(sequence), out); });
+        }
+    }
+    json.endArray();
+}
+
+} // namespace
+
 GameState::GameState() 
-    : m_currentTurn(1)
-    , m_phase(GamePhase::PLANNING)
-    , m_winner(-1)
+    : m_stateVersion(0)
+    , m_resetVersion(0)
+    , m_hasUncommittedChanges(false)
 {
 }
 
@@ -14,88 +155,156 @@ GameState::~GameState() {
 
 void GameState::initializeGame(const std::string& player1Name, const std::string& player2Name) {
     // Clear any existing game state
-    m_players.clear();
-    m_pendingActions.clear();
-    m_gameLog.clear();
-    m_currentTurn = 1;
-    m_phase = GamePhase::PLANNING;
-    m_winner = -1;
-    
-    // Create players
-    m_players.push_back(std::make_unique<Player>(0, player1Name));
-    m_players.push_back(std::make_unique<Player>(1, player2Name));
+    m_core = CoreState();
+    m_playerNames[0] = player1Name;
+    m_playerNames[1] = player2Name;
+    m_eventLog.clear();
+    m_resetVersion = m_stateVersion + 1;
+    m_hasUncommittedChanges = true;
     
     // Initialize player 1 nodes
-    m_players[0]->initializeNodes(Position(0, -4), Position(-1, -3), Position(1, -3));
+    m_core.players[0].initializeNodes(Position(0, -4), Position(-1, -3), Position(1, -3));
     
     // Initialize player 2 nodes
-    m_players[1]->initializeNodes(Position(0, 4), Position(-1, 3), Position(1, 3));
+    m_core.players[1].initializeNodes(Position(0, 4), Position(-1, 3), Position(1, 3));
     
     // Initialize player 1 units
-    m_players[0]->addInfantryGroup(Position(-1, -2), 45);
-    m_players[0]->addInfantryGroup(Position(1, -2), 45);
-    m_players[0]->setLongRangeUnit(Position(0, -2), 5);
+    m_core.players[0].addInfantryGroup(Position(-1, -2), 45);
+    m_core.players[0].addInfantryGroup(Position(1, -2), 45);
+    m_core.players[0].setLongRangeUnit(Position(0, -2), 5);
     
     // Initialize player 2 units
-    m_players[1]->addInfantryGroup(Position(-1, 2), 45);
-    m_players[1]->addInfantryGroup(Position(1, 2), 45);
-    m_players[1]->setLongRangeUnit(Position(0, 2), 5);
+    m_core.players[1].addInfantryGroup(Position(-1, 2), 45);
+    m_core.players[1].addInfantryGroup(Position(1, 2), 45);
+    m_core.players[1].setLongRangeUnit(Position(0, 2), 5);
+    
+    m_journal.reset(m_core);
     
     // Add initial game log entry
-    addToGameLog("Game started: " + player1Name + " vs " + player2Name);
+    logEvent(EventCode::GAME_STARTED);
+    commitChanges();
 }
 
-void GameState::submitAction(int playerId, const std::string& actionType, const Position& targetPos) {
-    if (m_phase != GamePhase::PLANNING) {
-        addToGameLog("Cannot submit action: not in planning phase");
-        return;
+SubmitResult GameState::submitAction(int playerId, ActionType actionType, const Position& targetPos, UnitHandle unit) {
+    NBD_TRACE_SCOPE("GameState::submitAction");
+    SubmitResult result = queueAction(playerId, actionType, targetPos, unit);
+    m_metrics.recordSubmit(actionType, result);
+    commitChanges();
+    return result;
+}
+
+size_t GameState::submitActions(const int32_t* tuples, size_t count, int32_t* results) {
+    NBD_TRACE_SCOPE("GameState::submitActions");
+    size_t accepted = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const int32_t* tuple = tuples + i * ACTION_TUPLE_WORDS;
+        // Unknown codes map to COUNT, which no validator accepts
+        ActionType actionType = tuple[1] >= 0 && tuple[1] < static_cast<int32_t>(ActionType::COUNT)
+            ? static_cast<ActionType>(tuple[1]) : ActionType::COUNT;
+        SubmitResult result = queueAction(tuple[0], actionType, Position(tuple[2], tuple[3]),
+                                          static_cast<UnitHandle>(tuple[4]));
+        m_metrics.recordSubmit(actionType, result);
+        results[i] = static_cast<int32_t>(result);
+        accepted += result == SubmitResult::ACCEPTED ? 1 : 0;
+    }
+    commitChanges();
+    return accepted;
+}
+
+// Validates and queues one action, logging the outcome; the caller commits
+SubmitResult GameState::queueAction(int playerId, ActionType actionType, const Position& targetPos, UnitHandle unit) {
+    if (m_core.phase != GamePhase::PLANNING) {
+        logEvent(EventCode::SUBMIT_WRONG_PHASE);
+        return SubmitResult::WRONG_PHASE;
     }
     
-    if (playerId < 0 || playerId >= static_cast<int>(m_players.size())) {
-        addToGameLog("Invalid player ID");
-        return;
+    if (playerId < 0 || playerId >= MAX_PLAYERS) {
+        logEvent(EventCode::INVALID_PLAYER);
+        return SubmitResult::INVALID_PLAYER;
     }
     
-    if (!isValidAction(playerId, actionType, targetPos)) {
-        addToGameLog("Invalid action: " + actionType);
-        return;
+    SubmitResult result = SubmitResult::ACCEPTED;
+    const UnitStore& units = m_core.players[playerId].getUnits();
+    int unitIndex = unit != INVALID_UNIT_HANDLE ? units.indexOf(unit) : -1;
+    if (unit != INVALID_UNIT_HANDLE && (unitIndex < 0 || units.getCount(unitIndex) <= 0)) {
+        result = SubmitResult::INVALID_UNIT;
+    } else if (!isValidAction(playerId, actionType, targetPos, unit)) {
+        result = SubmitResult::INVALID_ACTION;
+    } else if (countActions(m_core.pendingActions, playerId) >= MAX_PENDING_ACTIONS_PER_PLAYER) {
+        // A player's full share of the queue rejects their further actions
+        // until the turn resolves; the other player can still act
+        result = SubmitResult::QUEUE_FULL;
+    }
+    if (result != SubmitResult::ACCEPTED) {
+        logEvent(EventCode::INVALID_ACTION, playerId, -1, static_cast<int>(actionType));
+        return result;
     }
     
     // Add the action to pending actions
-    m_pendingActions.push_back({playerId, actionType, targetPos});
+    m_core.pendingActions.push_back({playerId, actionType, targetPos, unit});
     
     // Log action submission
-    addToGameLog(m_players[playerId]->getName() + " submitted action: " + actionType);
+    logEvent(EventCode::ACTION_SUBMITTED, playerId, -1, static_cast<int>(actionType));
+    return SubmitResult::ACCEPTED;
 }
 
 void GameState::processActions() {
-    if (m_phase != GamePhase::PLANNING) {
-        addToGameLog("Cannot process actions: not in planning phase");
+    NBD_TRACE_SCOPE("GameState::processActions");
+    if (m_core.phase != GamePhase::PLANNING) {
+        logEvent(EventCode::PROCESS_WRONG_PHASE);
+        commitChanges();
         return;
     }
     
-    m_phase = GamePhase::EXECUTING;
+    uint64_t start = Metrics::now();
+    m_core.phase = GamePhase::EXECUTING;
+    m_hasUncommittedChanges = true;
     
-    // Process all pending actions
-    for (const auto& action : m_pendingActions) {
+    // Process all pending actions; attacks only queue into the combat
+    // kernel, whose scratch lives on the turn arena. Last turn's spy
+    // reveals expire as this turn resolves.
+    TurnArena::reset();
+    CombatKernel combat(TurnArena::resource());
+    m_combat = &combat;
+    m_visibility.clearReveals();
+    for (const auto& action : m_core.pendingActions) {
         executeAction(action);
     }
-    
-    // Clear pending actions
-    m_pendingActions.clear();
+    resolveCombat();
+    m_combat = nullptr;
     
     // Check victory conditions
     checkVictoryConditions();
     
-    if (m_winner == -1) {
+    if (m_core.winner == -1) {
         // If no winner, prepare for next turn
-        m_phase = GamePhase::PLANNING;
-        m_currentTurn++;
+        m_core.phase = GamePhase::PLANNING;
+        m_core.currentTurn++;
     } else {
         // Game is over
-        m_phase = GamePhase::GAME_OVER;
-        addToGameLog("Game over: " + m_players[m_winner]->getName() + " wins!");
+        m_core.phase = GamePhase::GAME_OVER;
+        logEvent(EventCode::GAME_OVER, m_core.winner);
     }
+    
+    // Journal the turn, then clear pending actions
+    m_journal.recordTurn(m_core.pendingActions, m_core);
+    m_core.pendingActions.clear();
+    
+    commitChanges();
+    m_metrics.recordTurn(Metrics::now() - start);
+}
+
+bool GameState::replayTurn(const Action* actions, size_t count) {
+    if (m_core.phase != GamePhase::PLANNING || count > MAX_PENDING_ACTIONS) {
+        return false;
+    }
+    
+    m_core.pendingActions.clear();
+    for (size_t i = 0; i < count; ++i) {
+        m_core.pendingActions.push_back(actions[i]);
+    }
+    processActions();
+    return true;
 }
 
 void GameState::endTurn() {
@@ -104,238 +313,965 @@ void GameState::endTurn() {
 }
 
 bool GameState::isGameOver() const {
-    return m_phase == GamePhase::GAME_OVER;
+    return m_core.phase == GamePhase::GAME_OVER;
 }
 
 int GameState::getWinner() const {
-    return m_winner;
+    return m_core.winner;
+}
+
+void GameState::getLegalActions(int playerId, std::vector<Action>& out) const {
+    out.clear();
+    if (m_core.phase != GamePhase::PLANNING || playerId < 0 || playerId >= MAX_PLAYERS) {
+        return;
+    }
+    
+    int opponentId = 1 - playerId;
+    auto addIfValid = [&](ActionType type, const Position& target) {
+        if (isValidAction(playerId, type, target)) {
+            out.push_back({ playerId, type, target, INVALID_UNIT_HANDLE });
+        }
+    };
+    
+    // Spy ignores its target
+    addIfValid(ActionType::SPY, Position());
+    
+    for (const auto& node : m_core.players[opponentId].getNodes()) {
+        if (node.getHp() > 0) {
+            addIfValid(ActionType::HACK, node.getPosition());
+        }
+    }
+    for (const auto& node : m_core.players[playerId].getNodes()) {
+        if (node.getHp() > 0 && !node.isDefended()) {
+            addIfValid(ActionType::DEFEND, node.getPosition());
+        }
+    }
+    
+    // Attacks on occupied enemy cells, and each live unit's steps onto free
+    // cells next to it
+    Bitboard attackTargets = m_board.getThreats(playerId) & m_board.getOccupancy(opponentId);
+    attackTargets.forEach([&](int cell) { addIfValid(ActionType::ATTACK, cellPosition(cell)); });
+    
+    int longRange = m_board.findUnit(playerId, BoardView::KIND_LONG_RANGE, 0);
+    if (longRange != Board::NONE) {
+        const UnitStore& units = m_core.players[playerId].getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            if (units.getCount(i) <= 0) {
+                continue;
+            }
+            UnitHandle unit = units.getHandle(i);
+            m_board.getMoveTargets(longRange + static_cast<int>(i)).forEach([&](int cell) {
+                out.push_back({ playerId, ActionType::MOVE, cellPosition(cell), unit });
+            });
+        }
+    }
 }
 
 std::string GameState::serializeState() const {
-    std::stringstream ss;
+    std::string out;
+    serializeState(out);
+    return out;
+}
+
+void GameState::serializeState(std::string& out, bool compact) const {
+    writeState(out, compact, -1);
+}
+
+const std::string& GameState::getStateJson(bool compact) const {
+    int format = compact ? StateCache::FORMAT_COMPACT_JSON : StateCache::FORMAT_JSON;
+    return m_stateCache.getText(format, m_stateVersion,
+                                [&](std::string& out) { writeState(out, compact, -1); });
+}
+
+const std::string& GameState::getPlayerState(int playerId) const {
+    return m_stateCache.getText(StateCache::FORMAT_PLAYER_JSON + playerId, m_stateVersion,
+                                [&](std::string& out) { writeState(out, true, playerId); });
+}
+
+const std::vector<uint8_t>& GameState::getSnapshot() const {
+    return m_stateCache.getSnapshot(m_stateVersion, [&](std::vector<uint8_t>& out) { saveSnapshot(out); });
+}
+
+void GameState::writeState(std::string& out, bool compact, int viewerId) const {
+    NBD_TRACE_SCOPE("GameState::writeState");
+    uint64_t start = Metrics::now();
+    out.clear();
+    JsonWriter json(out, compact);
     
     // Basic game info
-    ss << "{\n";
-    ss << "  \"currentTurn\": " << m_currentTurn << ",\n";
-    ss << "  \"phase\": " << static_cast<int>(m_phase) << ",\n";
-    ss << "  \"winner\": " << m_winner << ",\n";
-    
-    // Players
-    ss << "  \"players\": [\n";
-    for (size_t i = 0; i < m_players.size(); i++) {
-        const auto& player = m_players[i];
-        ss << "    {\n";
-        ss << "      \"id\": " << player->getId() << ",\n";
-        ss << "      \"name\": \"" << player->getName() << "\",\n";
-        ss << "      \"intelPoints\": " << player->getIntelPoints() << ",\n";
+    json.beginObject();
+    json.field("currentTurn", m_core.currentTurn);
+    json.field("phase", static_cast<int>(m_core.phase));
+    json.field("winner", m_core.winner);
+    
+    // Players; a viewer only gets the enemy entities on cells it can see
+    json.key("players");
+    json.beginArray();
+    for (const auto& player : m_core.players) {
+        bool fogged = viewerId >= 0 && player.getId() != viewerId;
+        auto isShown = [&](const Position& pos) { return !fogged || m_visibility.isVisible(viewerId, pos); };
+        
+        json.beginObject();
+        json.field("id", player.getId());
+        json.field("name", m_playerNames[player.getId()]);
+        if (!fogged) {
+            json.field("intelPoints", player.getIntelPoints());
+        }
         
         // Nodes
-        ss << "      \"nodes\": {\n";
-        const auto& nodes = player->getNodes();
-        size_t nodeCount = 0;
-        for (const auto& nodePair : nodes) {
-            const auto& node = nodePair.second;
-            ss << "        \"" << node.getTypeName() << "\": {\n";
-            ss << "          \"type\": \"" << node.getTypeName() << "\",\n";
-            ss << "          \"posX\": " << node.getPosition().x << ",\n";
-            ss << "          \"posY\": " << node.getPosition().y << ",\n";
-            ss << "          \"hp\": " << node.getHp() << ",\n";
-            ss << "          \"maxHp\": " << node.getMaxHp() << ",\n";
-            ss << "          \"defended\": " << (node.isDefended() ? "true" : "false") << "\n";
-            ss << "        }" << (nodeCount < nodes.size() - 1 ? "," : "") << "\n";
-            nodeCount++;
-        }
-        ss << "      },\n";
+        json.key("nodes");
+        json.beginObject();
+        for (const auto& node : player.getNodes()) {
+            if (isShown(node.getPosition())) {
+                writeNodeJson(json, node);
+            }
+        }
+        json.endObject();
         
         // Infantry
-        ss << "      \"infantry\": [\n";
-        const auto& infantry = player->getInfantryGroups();
-        for (size_t j = 0; j < infantry.size(); j++) {
-            const auto& inf = infantry[j];
-            ss << "        {\n";
-            ss << "          \"id\": \"" << inf.getId() << "\",\n";
-            ss << "          \"posX\": " << inf.getPosition().x << ",\n";
-            ss << "          \"posY\": " << inf.getPosition().y << ",\n";
-            ss << "          \"count\": " << inf.getCount() << ",\n";
-            ss << "          \"hp\": " << inf.getHp() << ",\n";
-            ss << "          \"maxHp\": " << inf.getMaxHp() << "\n";
-            ss << "        }" << (j < infantry.size() - 1 ? "," : "") << "\n";
-        }
-        ss << "      ],\n";
+        json.key("infantry");
+        json.beginArray();
+        const auto& units = player.getUnits();
+        for (size_t i = FIRST_INFANTRY_INDEX; i < units.size(); ++i) {
+            if (isShown(units.getPosition(i))) {
+                json.beginObject();
+                writeUnitJsonFields(json, player.getId(), units, i);
+                json.endObject();
+            }
+        }
+        json.endArray();
         
         // Long Range Unit
-        const auto& lr = player->getLongRangeUnit();
-        ss << "      \"longRange\": {\n";
-        ss << "        \"id\": \"" << lr.getId() << "\",\n";
-        ss << "        \"posX\": " << lr.getPosition().x << ",\n";
-        ss << "        \"posY\": " << lr.getPosition().y << ",\n";
-        ss << "        \"count\": " << lr.getCount() << ",\n";
-        ss << "        \"hp\": " << lr.getHp() << ",\n";
-        ss << "        \"maxHp\": " << lr.getMaxHp() << "\n";
-        ss << "      }\n";
+        if (isShown(units.getPosition(0))) {
+            json.key("longRange");
+            json.beginObject();
+            writeUnitJsonFields(json, player.getId(), units, 0);
+            json.endObject();
+        }
+        
+        json.endObject();
+    }
+    json.endArray();
+    
+    if (viewerId >= 0) {
+        json.key("visibleCells");
+        json.beginArray();
+        m_visibility.getVisible(viewerId).forEach([&](int cell) {
+            json.value(cellPosition(cell).x);
+            json.value(cellPosition(cell).y);
+        });
+        json.endArray();
+    }
+    
+    // Game log (retained window only). A viewer's log skips the entries
+    // hidden from them, so it no longer runs contiguously from gameLogStart.
+    json.field("gameLogStart", m_eventLog.getFirstSequence());
+    json.key("gameLog");
+    writeLogJson(json, *this, m_eventLog.getFirstSequence(), viewerId);
+    
+    json.endObject();
+    m_metrics.recordSerialization(out.size(), Metrics::now() - start);
+}
+
+std::string GameState::getStateDelta(uint32_t sinceVersion) const {
+    std::string out;
+    getStateDelta(sinceVersion, out);
+    return out;
+}
+
+void GameState::getStateDelta(uint32_t sinceVersion, std::string& out) const {
+    NBD_TRACE_SCOPE("GameState::getStateDelta");
+    uint64_t start = Metrics::now();
+    out.clear();
+    JsonWriter json(out, true);
+    
+    // A client whose state predates the last reset must discard it; every
+    // entity is newer than its version, so the delta is then a full state.
+    bool reset = sinceVersion < m_resetVersion;
+    
+    json.beginObject();
+    json.field("version", m_stateVersion);
+    json.field("since", sinceVersion);
+    json.field("reset", reset);
+    json.field("currentTurn", m_core.currentTurn);
+    json.field("phase", static_cast<int>(m_core.phase));
+    json.field("winner", m_core.winner);
+    
+    json.key("players");
+    json.beginArray();
+    for (const auto& player : m_core.players) {
+        json.beginObject();
+        json.field("id", player.getId());
+        if (player.getVersion() > sinceVersion) {
+            json.field("name", m_playerNames[player.getId()]);
+            json.field("intelPoints", player.getIntelPoints());
+        }
+        
+        json.key("nodes");
+        json.beginObject();
+        for (const auto& node : player.getNodes()) {
+            if (node.getVersion() > sinceVersion) {
+                writeNodeJson(json, node);
+            }
+        }
+        json.endObject();
+        
+        // Changed groups carry their index so clients can patch in place
+        const auto& units = player.getUnits();
+        json.field("infantryCount", static_cast<int>(player.getInfantryCount()));
+        json.key("infantry");
+        json.beginArray();
+        for (size_t i = FIRST_INFANTRY_INDEX; i < units.size(); ++i) {
+            if (units.getVersion(i) > sinceVersion) {
+                json.beginObject();
+                json.field("index", static_cast<int>(i - FIRST_INFANTRY_INDEX));
+                writeUnitJsonFields(json, player.getId(), units, i);
+                json.endObject();
+            }
+        }
+        json.endArray();
+        
+        if (units.getVersion(0) > sinceVersion) {
+            json.key("longRange");
+            json.beginObject();
+            writeUnitJsonFields(json, player.getId(), units, 0);
+            json.endObject();
+        }
+        
+        json.endObject();
+    }
+    json.endArray();
+    
+    // Log entries are appended in version order
+    uint32_t logStart = m_eventLog.findFirstAfterVersion(sinceVersion);
+    json.field("gameLogStart", logStart);
+    json.key("gameLog");
+    writeLogJson(json, *this, logStart);
+    
+    json.endObject();
+    m_metrics.recordSerialization(out.size(), Metrics::now() - start);
+}
+
+void GameState::commitChanges() {
+    bool changed = m_hasUncommittedChanges;
+    for (const auto& player : m_core.players) {
+        changed = changed || player.hasPendingChanges();
+    }
+    if (!changed) {
+        return;
+    }
+    
+    m_stateVersion++;
+    for (auto& player : m_core.players) {
+        player.commitChanges(m_stateVersion);
+    }
+    m_hasUncommittedChanges = false;
+    
+    m_board.update(m_core.players, m_stateVersion);
+    m_visibility.update(m_core.players, m_stateVersion);
+    m_boardView.update(m_core.players, m_core.currentTurn, static_cast<int>(m_core.phase), m_core.winner, m_stateVersion);
+}
+
+void GameState::getMetrics(Metrics::Array& out) const {
+    m_metrics.write(out);
+    out[Metrics::WORD_CACHE_HITS] = m_stateCache.getStats().hits;
+    out[Metrics::WORD_CACHE_MISSES] = m_stateCache.getStats().misses;
+    out[Metrics::WORD_LOG_ENTRIES] = m_eventLog.size();
+    out[Metrics::WORD_LOG_TOTAL] = m_eventLog.getEndSequence();
+    out[Metrics::WORD_HEAP_BYTES] = static_cast<double>(Metrics::heapBytesInUse());
+    out[Metrics::WORD_ARENA_PEAK_BYTES] = static_cast<double>(TurnArena::getStats().peakBytes);
+    out[Metrics::WORD_ARENA_HEAP_ALLOCATIONS] = static_cast<double>(TurnArena::getStats().heapAllocations);
+}
+
+void GameState::resetMetrics() {
+    m_metrics.reset();
+    m_stateCache.resetStats();
+}
+
+bool GameState::deserializeState(const std::string& jsonState) {
+    JsonValue root;
+    if (!JsonValue::parse(jsonState, root) || !root.isObject()) {
+        std::cerr << "Warning: game state JSON could not be parsed; state loading skipped" << std::endl;
+        return false;
+    }
+    
+    GameState loaded;
+    int phase = 0;
+    const JsonValue* players = root.find("players");
+    if (!readIntField(root, "currentTurn", loaded.m_core.currentTurn) ||
+        !readIntField(root, "phase", phase) ||
+        !readIntField(root, "winner", loaded.m_core.winner) ||
+        !players || players->getItems().size() != 2) {
+        std::cerr << "Warning: game state JSON is missing required fields; state loading skipped" << std::endl;
+        return false;
+    }
+    loaded.m_core.phase = static_cast<GamePhase>(phase);
+    
+    for (size_t index = 0; index < players->getItems().size(); ++index) {
+        const JsonValue& playerJson = players->getItems()[index];
+        int id = 0;
+        int intelPoints = 0;
+        std::string name;
+        const JsonValue* nameJson = playerJson.find("name");
+        const JsonValue* nodes = playerJson.find("nodes");
+        const JsonValue* infantry = playerJson.find("infantry");
+        const JsonValue* longRange = playerJson.find("longRange");
+        if (!readIntField(playerJson, "id", id) ||
+            !readIntField(playerJson, "intelPoints", intelPoints) ||
+            !nameJson || !nameJson->getString(name) ||
+            !nodes || !nodes->isObject() || !infantry || !longRange || id != static_cast<int>(index)) {
+            std::cerr << "Warning: malformed player in game state JSON; state loading skipped" << std::endl;
+            return false;
+        }
+        
+        Player player(id);
+        player.setIntelPoints(intelPoints);
+        
+        static const char* const nodeKeys[] = { "core", "comms", "rd" };
+        for (const char* nodeKey : nodeKeys) {
+            const JsonValue* node = nodes->find(nodeKey);
+            if (!node) {
+                continue;
+            }
+            int x = 0, y = 0, hp = 0, maxHp = 0;
+            bool defended = false;
+            const JsonValue* defendedJson = node->find("defended");
+            if (!readIntField(*node, "posX", x) || !readIntField(*node, "posY", y) ||
+                !readIntField(*node, "hp", hp) || !readIntField(*node, "maxHp", maxHp) ||
+                !defendedJson || !defendedJson->getBool(defended)) {
+                std::cerr << "Warning: malformed node in game state JSON; state loading skipped" << std::endl;
+                return false;
+            }
+            player.addNode(nodeKey, Position(x, y), hp, maxHp, defended);
+        }
+        
+        if (infantry->getItems().size() > MAX_INFANTRY_GROUPS) {
+            std::cerr << "Warning: too many infantry groups in game state JSON; state loading skipped" << std::endl;
+            return false;
+        }
+        for (const auto& groupJson : infantry->getItems()) {
+            UnitRecord group;
+            if (!readUnitJson(groupJson, group) || !addInfantryRecord(player, group)) {
+                std::cerr << "Warning: malformed infantry group in game state JSON; state loading skipped" << std::endl;
+                return false;
+            }
+        }
+        
+        UnitRecord unit;
+        if (!readUnitJson(*longRange, unit) || !setLongRangeRecord(player, unit)) {
+            std::cerr << "Warning: malformed long range unit in game state JSON; state loading skipped" << std::endl;
+            return false;
+        }
+        
+        loaded.m_core.players[index] = player;
+        loaded.m_playerNames[index] = name;
+    }
+    
+    // Log text cannot be turned back into events; record the restore instead
+    loaded.logEvent(EventCode::STATE_RESTORED);
+    
+    if (!loaded.hasConsistentState()) {
+        std::cerr << "Warning: game state JSON is inconsistent; state loading skipped" << std::endl;
+        return false;
+    }
+    
+    adoptLoadedState(std::move(loaded));
+    return true;
+}
+
+void GameState::saveSnapshot(std::vector<uint8_t>& out) const {
+    NBD_TRACE_SCOPE("GameState::saveSnapshot");
+    uint64_t start = Metrics::now();
+    out.clear();
+    SnapshotWriter writer(out);
+    writer.writeHeader();
+    
+    writer.writeInt(m_core.currentTurn);
+    writer.writeInt(static_cast<int32_t>(m_core.phase));
+    writer.writeInt(m_core.winner);
+    writer.writeInt(MAX_PLAYERS);
+    
+    for (const auto& player : m_core.players) {
+        writer.writeInt(player.getId());
+        writer.writeInt(player.getIntelPoints());
+        writer.writeString(m_playerNames[player.getId()]);
         
-        ss << "    }" << (i < m_players.size() - 1 ? "," : "") << "\n";
+        const auto& nodes = player.getNodes();
+        writer.writeInt(static_cast<int32_t>(nodes.size()));
+        for (const auto& node : nodes) {
+            writer.writeInt(static_cast<int32_t>(node.getType()));
+            writer.writeInt(node.getPosition().x);
+            writer.writeInt(node.getPosition().y);
+            writer.writeInt(node.getHp());
+            writer.writeInt(node.getMaxHp());
+            writer.writeInt(node.isDefended() ? 1 : 0);
+        }
+        
+        const auto& units = player.getUnits();
+        writer.writeInt(static_cast<int32_t>(player.getInfantryCount()));
+        for (size_t u = FIRST_INFANTRY_INDEX; u < units.size(); ++u) {
+            writeUnitSnapshot(writer, units, u);
+        }
+        
+        writeUnitSnapshot(writer, units, 0);
+    }
+    
+    writer.writeInt(static_cast<int32_t>(m_core.pendingActions.size()));
+    for (const auto& action : m_core.pendingActions) {
+        writer.writeInt(action.playerId);
+        writer.writeInt(static_cast<int32_t>(action.type));
+        writer.writeInt(action.targetPos.x);
+        writer.writeInt(action.targetPos.y);
+        writer.writeInt(static_cast<int32_t>(action.unit));
+    }
+    
+    writer.writeInt(static_cast<int32_t>(m_eventLog.getFirstSequence()));
+    writer.writeInt(static_cast<int32_t>(m_eventLog.size()));
+    for (uint32_t sequence = m_eventLog.getFirstSequence(); sequence < m_eventLog.getEndSequence(); ++sequence) {
+        const GameEvent& event = m_eventLog.at(sequence);
+        writer.writeInt(static_cast<int32_t>(event.code));
+        writer.writeInt(event.turn);
+        writer.writeInt(event.actor);
+        writer.writeInt(event.target);
+        writer.writeInt(event.detail);
+        writer.writeInt(event.amount);
+    }
+    
+    writer.finish();
+    m_metrics.recordSerialization(out.size(), Metrics::now() - start);
+}
+
+bool GameState::loadSnapshot(const uint8_t* data, size_t size) {
+    SnapshotReader reader(data, size);
+    if (!reader.readHeader()) {
+        std::cerr << "Warning: unrecognized snapshot header; state loading skipped" << std::endl;
+        return false;
+    }
+    
+    GameState loaded;
+    int32_t phase = 0;
+    int32_t playerCount = 0;
+    if (!reader.readInt(loaded.m_core.currentTurn) || !reader.readInt(phase) ||
+        !reader.readInt(loaded.m_core.winner) || !reader.readCount(playerCount, 8) ||
+        playerCount != MAX_PLAYERS) {
+        std::cerr << "Warning: truncated snapshot; state loading skipped" << std::endl;
+        return false;
     }
-    ss << "  ],\n";
+    loaded.m_core.phase = static_cast<GamePhase>(phase);
     
-    // Game log
-    ss << "  \"gameLog\": [\n";
-    for (size_t i = 0; i < m_gameLog.size(); i++) {
-        ss << "    \"" << escapeJsonString(m_gameLog[i]) << "\"" << (i < m_gameLog.size() - 1 ? "," : "") << "\n";
+    for (int32_t i = 0; i < playerCount; ++i) {
+        int32_t id = 0;
+        int32_t intelPoints = 0;
+        int32_t nodeCount = 0;
+        std::string name;
+        if (!reader.readInt(id) || !reader.readInt(intelPoints) || !reader.readString(name) ||
+            !reader.readCount(nodeCount, 6 * sizeof(int32_t))) {
+            std::cerr << "Warning: truncated snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        if (id != i || nodeCount > static_cast<int32_t>(NODE_TYPE_COUNT)) {
+            std::cerr << "Warning: malformed player in snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        
+        Player player(id);
+        player.setIntelPoints(intelPoints);
+        
+        for (int32_t n = 0; n < nodeCount; ++n) {
+            int32_t type = 0, x = 0, y = 0, hp = 0, maxHp = 0, defended = 0;
+            if (!reader.readInt(type) || !reader.readInt(x) || !reader.readInt(y) ||
+                !reader.readInt(hp) || !reader.readInt(maxHp) || !reader.readInt(defended) ||
+                type < static_cast<int32_t>(NodeType::CORE) || type > static_cast<int32_t>(NodeType::RD)) {
+                std::cerr << "Warning: malformed node in snapshot; state loading skipped" << std::endl;
+                return false;
+            }
+            Node node(static_cast<NodeType>(type), Position(x, y), hp, maxHp);
+            node.setDefended(defended != 0);
+            player.addNode(node);
+        }
+        
+        int32_t infantryCount = 0;
+        if (!reader.readCount(infantryCount, 6 * sizeof(int32_t))) {
+            std::cerr << "Warning: truncated snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        if (infantryCount > static_cast<int32_t>(MAX_INFANTRY_GROUPS)) {
+            std::cerr << "Warning: too many infantry groups in snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        for (int32_t g = 0; g < infantryCount; ++g) {
+            UnitRecord group;
+            if (!readUnitSnapshot(reader, group) || !addInfantryRecord(player, group)) {
+                std::cerr << "Warning: malformed infantry group in snapshot; state loading skipped" << std::endl;
+                return false;
+            }
+        }
+        
+        UnitRecord unit;
+        if (!readUnitSnapshot(reader, unit) || !setLongRangeRecord(player, unit)) {
+            std::cerr << "Warning: malformed long range unit in snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        
+        loaded.m_core.players[i] = player;
+        loaded.m_playerNames[i] = name;
+    }
+    
+    int32_t actionCount = 0;
+    if (!reader.readCount(actionCount, 5 * sizeof(int32_t))) {
+        std::cerr << "Warning: truncated snapshot; state loading skipped" << std::endl;
+        return false;
+    }
+    for (int32_t i = 0; i < actionCount; ++i) {
+        Action action;
+        int32_t type = 0;
+        int32_t unit = 0;
+        if (!reader.readInt(action.playerId) || !reader.readInt(type) ||
+            !reader.readInt(action.targetPos.x) || !reader.readInt(action.targetPos.y) ||
+            !reader.readInt(unit) || type < 0 || type >= static_cast<int32_t>(ActionType::COUNT) ||
+            action.playerId < 0 || action.playerId >= MAX_PLAYERS) {
+            std::cerr << "Warning: malformed action in snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        action.type = static_cast<ActionType>(type);
+        action.unit = static_cast<UnitHandle>(unit);
+        if (countActions(loaded.m_core.pendingActions, action.playerId) >= MAX_PENDING_ACTIONS_PER_PLAYER ||
+            !loaded.m_core.pendingActions.push_back(action)) {
+            std::cerr << "Warning: too many actions in snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+    }
+    
+    int32_t logStart = 0;
+    int32_t logCount = 0;
+    if (!reader.readInt(logStart) || logStart < 0 ||
+        !reader.readCount(logCount, 6 * sizeof(int32_t)) ||
+        logCount > static_cast<int32_t>(EventLog::CAPACITY)) {
+        std::cerr << "Warning: malformed log in snapshot; state loading skipped" << std::endl;
+        return false;
+    }
+    loaded.m_eventLog.clear(static_cast<uint32_t>(logStart));
+    for (int32_t i = 0; i < logCount; ++i) {
+        int32_t code, turn, actor, target, detail, amount;
+        if (!reader.readInt(code) || !reader.readInt(turn) || !reader.readInt(actor) ||
+            !reader.readInt(target) || !reader.readInt(detail) || !reader.readInt(amount) ||
+            code < 0 || code >= static_cast<int32_t>(EventCode::COUNT) ||
+            turn < 0 || turn > UINT16_MAX || actor < -1 || actor > 1 || target < -1 || target > 1 ||
+            detail < 0 || detail > UINT8_MAX) {
+            std::cerr << "Warning: malformed log entry in snapshot; state loading skipped" << std::endl;
+            return false;
+        }
+        GameEvent event = {};
+        event.code = static_cast<EventCode>(code);
+        event.turn = static_cast<uint16_t>(turn);
+        event.actor = static_cast<int8_t>(actor);
+        event.target = static_cast<int8_t>(target);
+        event.detail = static_cast<uint8_t>(detail);
+        event.amount = amount;
+        loaded.m_eventLog.append(event);
+    }
+    
+    if (!reader.atEnd() || !loaded.hasConsistentState()) {
+        std::cerr << "Warning: snapshot is inconsistent; state loading skipped" << std::endl;
+        return false;
+    }
+    
+    adoptLoadedState(std::move(loaded));
+    return true;
+}
+
+bool GameState::restore(const CoreState& state) {
+    if (!hasConsistentState(state)) {
+        std::cerr << "Warning: core state is inconsistent; restore skipped" << std::endl;
+        return false;
+    }
+    
+    m_core = state;
+    publishAsReset();
+    return true;
+}
+
+void GameState::adoptLoadedState(GameState&& loaded) {
+    uint32_t version = m_stateVersion;
+    StateCache cache = std::move(m_stateCache);
+    Metrics metrics = m_metrics;
+    *this = std::move(loaded);
+    
+    // Keep versions monotonic across the load, and with them this state's
+    // cache: its entries all predate the reset version, so they go stale.
+    // Metrics cover the whole session, loads included.
+    m_stateVersion = version;
+    m_stateCache = std::move(cache);
+    m_metrics = metrics;
+    m_eventLog.setAllVersions(version + 1);
+    publishAsReset();
+}
+
+void GameState::publishAsReset() {
+    // Delta readers older than the reset must refetch everything
+    m_resetVersion = m_stateVersion + 1;
+    m_journal.reset(m_core);
+    m_visibility.clearReveals();
+    for (auto& player : m_core.players) {
+        player.markAllDirty();
+    }
+    m_hasUncommittedChanges = true;
+    commitChanges();
+}
+
+bool GameState::hasConsistentState() const {
+    return hasConsistentState(m_core);
+}
+
+bool GameState::hasConsistentState(const CoreState& core) {
+    if (core.currentTurn < 1 || core.winner < -1 || core.winner > 1) {
+        return false;
+    }
+    if (core.phase != GamePhase::PLANNING && core.phase != GamePhase::EXECUTING && core.phase != GamePhase::GAME_OVER) {
+        return false;
+    }
+    for (int i = 0; i < MAX_PLAYERS; ++i) {
+        if (core.players[i].getId() != i) {
+            return false;
+        }
+    }
+    for (const auto& action : core.pendingActions) {
+        if (action.playerId < 0 || action.playerId >= MAX_PLAYERS) {
+            return false;
+        }
     }
-    ss << "  ]\n";
     
-    ss << "}";
-    return ss.str();
+    // Game rules: everything stands on the board, HP stays within
+    // [0, maxHp], and nothing holds a negative count or intel
+    for (const auto& player : core.players) {
+        if (player.getIntelPoints() < 0) {
+            return false;
+        }
+        for (const auto& node : player.getNodes()) {
+            if (!Board::isValid(node.getPosition()) || node.getHp() < 0 || node.getHp() > node.getMaxHp()) {
+                return false;
+            }
+        }
+        const UnitStore& units = player.getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            if (!Board::isValid(units.getPosition(i)) || units.getCount(i) < 0 ||
+                units.getHp(i) < 0 || units.getHp(i) > units.getMaxHp(i)) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
-void GameState::deserializeState(const std::string& jsonState) {
-    // For the simplified version, we won't implement full parsing
-    // Instead, just provide a warning
-    std::cerr << "Warning: Full JSON deserialization not implemented in simplified version" << std::endl;
-    std::cerr << "State loading skipped" << std::endl;
+void GameState::resolveCombat() {
+    NBD_TRACE_SCOPE("GameState::resolveCombat");
+    if (m_combat->getTargetCount() == 0) {
+        return;
+    }
     
-    // Basic initialization to ensure the game is in a valid state
-    if (m_players.empty()) {
-        initializeGame("Player 1", "Player 2");
+    m_combat->resolve();
+    for (size_t t = 0; t < m_combat->getTargetCount(); ++t) {
+        Player& owner = m_core.players[m_combat->getTargetOwner(t)];
+        int damage = m_combat->getDamage(t);
+        TargetType type = m_combat->getTargetType(t);
+        if (type == TargetType::INFANTRY || type == TargetType::LONG_RANGE) {
+            UnitStore& units = owner.getUnits();
+            int index = units.indexOf(static_cast<UnitHandle>(m_combat->getTargetRef(t)));
+            if (index >= 0) {
+                units.damage(index, damage);
+            }
+        } else {
+            owner.damageNode(static_cast<NodeType>(m_combat->getTargetRef(t)), damage);
+        }
     }
 }
 
 void GameState::checkVictoryConditions() {
+    NBD_TRACE_SCOPE("GameState::checkVictoryConditions");
     // Check if any player's core node is destroyed
-    for (size_t i = 0; i < m_players.size(); ++i) {
-        if (!m_players[i]->isCoreAlive()) {
-            m_winner = 1 - static_cast<int>(i);  // Opponent wins
-            m_phase = GamePhase::GAME_OVER;
+    for (int i = 0; i < MAX_PLAYERS; ++i) {
+        if (!m_core.players[i].isCoreAlive()) {
+            m_core.winner = 1 - i;  // Opponent wins
+            m_core.phase = GamePhase::GAME_OVER;
             return;
         }
     }
 }
 
-void GameState::addToGameLog(const std::string& message) {
-    m_gameLog.push_back(message);
+void GameState::logEvent(EventCode code, int actor, int target, int detail, int amount) {
+    GameEvent event = {};
+    event.version = m_stateVersion + 1;
+    event.amount = amount;
+    event.turn = static_cast<uint16_t>(m_core.currentTurn);
+    event.code = code;
+    event.actor = static_cast<int8_t>(actor);
+    event.target = static_cast<int8_t>(target);
+    event.detail = static_cast<uint8_t>(detail);
+    m_eventLog.append(event);
+    m_hasUncommittedChanges = true;
 }
 
-bool GameState::isValidAction(int playerId, const std::string& actionType, const Position& targetPos) const {
-    const Player& player = *m_players[playerId];
+void GameState::formatEvent(const GameEvent& event, std::string& out) const {
+    auto playerName = [this](int id) -> const std::string& {
+        static const std::string unknown = "Unknown player";
+        return id >= 0 && id < MAX_PLAYERS ? m_playerNames[id] : unknown;
+    };
     
-    // Check if action is valid based on game rules
-    if (actionType == "move") {
-        // Check if player has units at the given location
-        // Detailed implementation needed
-        return true;
-    } 
-    else if (actionType == "attack") {
-        // Check if attack is valid (range, target, etc.)
-        return player.isRDLabAlive();
-    } 
-    else if (actionType == "hack") {
-        // Check if hack is valid (enough IP, etc.)
-        return player.isRDLabAlive() && player.getIntelPoints() >= 40;
-    }
-    else if (actionType == "defend") {
-        // Check if defend is valid
-        return true;
+    switch (event.code) {
+        case EventCode::GAME_STARTED:
+            out += "Game started: ";
+            out += playerName(0);
+            out += " vs ";
+            out += playerName(1);
+            break;
+        case EventCode::SUBMIT_WRONG_PHASE:
+            out += "Cannot submit action: not in planning phase";
+            break;
+        case EventCode::INVALID_PLAYER:
+            out += "Invalid player ID";
+            break;
+        case EventCode::INVALID_ACTION:
+            out += "Invalid action: ";
+            out += getActionTypeName(static_cast<ActionType>(event.detail));
+            break;
+        case EventCode::ACTION_SUBMITTED:
+            out += playerName(event.actor);
+            out += " submitted action: ";
+            out += getActionTypeName(static_cast<ActionType>(event.detail));
+            break;
+        case EventCode::PROCESS_WRONG_PHASE:
+            out += "Cannot process actions: not in planning phase";
+            break;
+        case EventCode::UNIT_MOVED:
+            out += playerName(event.actor);
+            out += " moved a unit";
+            break;
+        case EventCode::ATTACKED:
+            out += playerName(event.actor);
+            out += " attacked ";
+            out += playerName(event.target);
+            break;
+        case EventCode::ATTACK_FAILED:
+            out += playerName(event.actor);
+            out += " tried to attack but R&D Lab is down";
+            break;
+        case EventCode::HACKED:
+            out += playerName(event.actor);
+            out += " hacked ";
+            out += playerName(event.target);
+            out += "'s ";
+            out += getNodeTypeName(static_cast<NodeType>(event.detail));
+            break;
+        case EventCode::HACK_FAILED:
+            out += playerName(event.actor);
+            out += " tried to hack but lacked resources";
+            break;
+        case EventCode::DEFENDED:
+            out += playerName(event.actor);
+            out += " defended their ";
+            out += getNodeTypeName(static_cast<NodeType>(event.detail));
+            break;
+        case EventCode::SPIED:
+            out += playerName(event.actor);
+            out += " used spy and gained ";
+            out += std::to_string(event.amount);
+            out += " IP";
+            break;
+        case EventCode::SPY_FAILED:
+            out += playerName(event.actor);
+            out += " tried to spy but Comms is down";
+            break;
+        case EventCode::GAME_OVER:
+            out += "Game over: ";
+            out += playerName(event.actor);
+            out += " wins!";
+            break;
+        case EventCode::STATE_RESTORED:
+            out += "Game state restored";
+            break;
+        default:
+            out += "Unknown event";
+            break;
+    }
+}
+
+std::vector<std::string> GameState::getGameLog() const {
+    std::vector<std::string> entries;
+    getLogRange(m_eventLog.getFirstSequence(), m_eventLog.size(), entries);
+    return entries;
+}
+
+void GameState::getLogRange(uint32_t fromSequence, uint32_t count, std::vector<std::string>& out) const {
+    out.clear();
+    uint32_t begin = std::max(fromSequence, m_eventLog.getFirstSequence());
+    uint32_t end = m_eventLog.getEndSequence();
+    if (begin >= end) {
+        return;
     }
-    else if (actionType == "spy") {
-        // Check if spy is valid
-        return player.isCommsAlive();
+    end = std::min(end, begin + std::min(count, end - begin));
+    out.reserve(end - begin);
+    for (uint32_t sequence = begin; sequence < end; ++sequence) {
+        out.emplace_back();
+        formatEvent(m_eventLog.at(sequence), out.back());
     }
+}
+
+const GameState::ActionHandler& GameState::getActionHandler(ActionType type) {
+    // Indexed by ActionType; one validator/executor pair per action
+    static constexpr ActionHandler handlers[] = {
+        { &GameState::validateMove, &GameState::executeMove },
+        { &GameState::validateAttack, &GameState::executeAttack },
+        { &GameState::validateHack, &GameState::executeHack },
+        { &GameState::validateDefend, &GameState::executeDefend },
+        { &GameState::validateSpy, &GameState::executeSpy },
+    };
+    static_assert(sizeof(handlers) / sizeof(handlers[0]) == static_cast<size_t>(ActionType::COUNT),
+                  "every ActionType needs a handler");
     
-    return false;
+    return handlers[static_cast<size_t>(type)];
+}
+
+bool GameState::isValidAction(int playerId, ActionType actionType, const Position& targetPos, UnitHandle unit) const {
+    if (static_cast<size_t>(actionType) >= static_cast<size_t>(ActionType::COUNT)) {
+        return false;
+    }
+    
+    // Check if action is valid based on game rules
+    const Player& player = m_core.players[playerId];
+    return (this->*getActionHandler(actionType).validate)(player, targetPos, unit);
 }
 
 void GameState::executeAction(const Action& action) {
     int playerId = action.playerId;
-    Player& player = *m_players[playerId];
+    Player& player = m_core.players[playerId];
     int opponentId = 1 - playerId;
-    Player& opponent = *m_players[opponentId];
-    
-    if (action.actionType == "move") {
-        // Implementation for move action
-        // Need to identify which unit to move
-        addToGameLog(player.getName() + " moved a unit");
-    } 
-    else if (action.actionType == "attack") {
-        // Implementation for attack action
-        if (player.isRDLabAlive()) {
-            // Find target
-            // Calculate damage
-            // Apply damage
-            addToGameLog(player.getName() + " attacked " + opponent.getName());
-        } else {
-            addToGameLog(player.getName() + " tried to attack but R&D Lab is down");
-        }
-    } 
-    else if (action.actionType == "hack") {
-        // Implementation for hack action
-        if (player.isRDLabAlive() && player.getIntelPoints() >= 40) {
-            player.spendIntelPoints(40);
-            
-            // Find target node in opponent's nodes
-            for (const auto& nodePair : opponent.getNodes()) {
-                const Node& node = nodePair.second;
-                if (node.getPosition() == action.targetPos) {
-                    // Apply hack damage (50 HP)
-                    opponent.damageNode(node.getType(), 50);
-                    addToGameLog(player.getName() + " hacked " + opponent.getName() + "'s " + node.getTypeName());
-                    break;
-                }
+    Player& opponent = m_core.players[opponentId];
+    
+    (this->*getActionHandler(action.type).execute)(action, player, opponent);
+}
+
+bool GameState::validateMove(const Player& player, const Position& targetPos, UnitHandle unit) const {
+    // A named unit steps onto a free cell next to it. Without one the move
+    // names no unit and does nothing.
+    if (unit == INVALID_UNIT_HANDLE) {
+        return true;
+    }
+    int index = player.getUnits().indexOf(unit);
+    int entity = m_board.findUnit(player.getId(), BoardView::KIND_LONG_RANGE, 0);
+    int cell = Board::cellIndex(targetPos);
+    return index >= 0 && entity != Board::NONE && cell != Board::NONE &&
+           m_board.getMoveTargets(entity + index).test(cell);
+}
+
+bool GameState::validateAttack(const Player& player, const Position& /*targetPos*/, UnitHandle /*unit*/) const {
+    // Check if attack is valid (range, target, etc.)
+    return player.isRDLabAlive();
+}
+
+bool GameState::validateHack(const Player& player, const Position& /*targetPos*/, UnitHandle /*unit*/) const {
+    // Check if hack is valid (enough IP, etc.)
+    return player.isRDLabAlive() && player.getIntelPoints() >= 40;
+}
+
+bool GameState::validateDefend(const Player& /*player*/, const Position& /*targetPos*/, UnitHandle /*unit*/) const {
+    // Check if defend is valid
+    return true;
+}
+
+bool GameState::validateSpy(const Player& player, const Position& /*targetPos*/, UnitHandle /*unit*/) const {
+    // Check if spy is valid
+    return player.isCommsAlive();
+}
+
+void GameState::executeMove(const Action& action, Player& player, Player& /*opponent*/) {
+    NBD_TRACE_SCOPE("GameState::executeMove");
+    // The unit may have died earlier in the turn
+    UnitStore& units = player.getUnits();
+    int index = action.unit != INVALID_UNIT_HANDLE ? units.indexOf(action.unit) : -1;
+    if (index >= 0 && units.getCount(index) > 0) {
+        units.setPosition(index, action.targetPos);
+    }
+    logEvent(EventCode::UNIT_MOVED, player.getId());
+}
+
+void GameState::executeAttack(const Action& action, Player& player, Player& opponent) {
+    NBD_TRACE_SCOPE("GameState::executeAttack");
+    // The acting units join the turn's combat: the named unit, or without
+    // one every live unit that reaches the target cell. Each attack adds the
+    // live enemy units and the nodes on its target cell. resolveCombat then applies the
+    // damage of every attacker in reach of every target.
+    if (player.isRDLabAlive()) {
+        const UnitStore& units = player.getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            bool acting = action.unit != INVALID_UNIT_HANDLE ? units.getHandle(i) == action.unit
+                                                             : units.canAttack(i, action.targetPos);
+            if (acting) {
+                m_combat->addAttacker(player.getId(), units.getKind(i), units.getPosition(i), units.getCount(i),
+                                      static_cast<int32_t>(units.getHandle(i)));
             }
-        } else {
-            addToGameLog(player.getName() + " tried to hack but lacked resources");
         }
-    }
-    else if (action.actionType == "defend") {
-        // Implementation for defend action
-        for (const auto& nodePair : player.getNodes()) {
-            const Node& node = nodePair.second;
+        
+        // Targets come from the players, not the Board: units that moved or
+        // died earlier this turn are only re-linked at the next commit
+        const UnitStore& targets = opponent.getUnits();
+        for (size_t i = 0; i < targets.size(); ++i) {
+            if (targets.getCount(i) > 0 && targets.getPosition(i) == action.targetPos) {
+                TargetType type = targets.getKind(i) == UnitKind::INFANTRY ? TargetType::INFANTRY : TargetType::LONG_RANGE;
+                m_combat->addTarget(opponent.getId(), type, action.targetPos, static_cast<int32_t>(targets.getHandle(i)));
+            }
+        }
+        for (const auto& node : opponent.getNodes()) {
             if (node.getPosition() == action.targetPos) {
-                player.defendNode(node.getType());
-                addToGameLog(player.getName() + " defended their " + node.getTypeName());
-                break;
+                // NodeType values follow the units in TargetType order
+                int kind = static_cast<int>(node.getType());
+                TargetType type = static_cast<TargetType>(static_cast<int>(TargetType::CORE) + kind);
+                m_combat->addTarget(opponent.getId(), type, action.targetPos, kind);
             }
         }
+        logEvent(EventCode::ATTACKED, player.getId(), opponent.getId());
+    } else {
+        logEvent(EventCode::ATTACK_FAILED, player.getId());
     }
-    else if (action.actionType == "spy") {
-        // Implementation for spy action
-        if (player.isCommsAlive()) {
-            player.addIntelPoints(15);
-            addToGameLog(player.getName() + " used spy and gained 15 IP");
-            
-            // In a real implementation, this would reveal enemy moves
-        } else {
-            addToGameLog(player.getName() + " tried to spy but Comms is down");
+}
+
+void GameState::executeHack(const Action& action, Player& player, Player& opponent) {
+    NBD_TRACE_SCOPE("GameState::executeHack");
+    // Implementation for hack action
+    if (player.isRDLabAlive() && player.getIntelPoints() >= 40) {
+        player.spendIntelPoints(40);
+        
+        // Find target node in opponent's nodes
+        int target = m_board.findNodeAt(action.targetPos, opponent.getId());
+        if (target != Board::NONE) {
+            // Apply hack damage (50 HP)
+            NodeType type = static_cast<NodeType>(m_board.getEntity(target).kind);
+            opponent.damageNode(type, 50);
+            logEvent(EventCode::HACKED, player.getId(), opponent.getId(), static_cast<int>(type), 50);
         }
+    } else {
+        logEvent(EventCode::HACK_FAILED, player.getId());
     }
 }
 
-// Helper function to escape JSON strings
-std::string GameState::escapeJsonString(const std::string& input) const {
-    std::string output;
-    output.reserve(input.length() * 2); // Reserve space to avoid reallocations
-    
-    for (auto ch : input) {
-        switch (ch) {
-            case '\"': output += "\\\""; break;
-            case '\\': output += "\\\\"; break;
-            case '\b': output += "\\b"; break;
-            case '\f': output += "\\f"; break;
-            case '\n': output += "\\n"; break;
-            case '\r': output += "\\r"; break;
-            case '\t': output += "\\t"; break;
-            default:
-                if (static_cast<unsigned char>(ch) < 32) {
-                    // Control characters
-                    char buf[7];
-                    snprintf(buf, 7, "\\u%04x", ch);
-                    output += buf;
-                } else {
-                    output += ch;
-                }
-                break;
-        }
+void GameState::executeDefend(const Action& action, Player& player, Player& /*opponent*/) {
+    NBD_TRACE_SCOPE("GameState::executeDefend");
+    // Implementation for defend action
+    int target = m_board.findNodeAt(action.targetPos, player.getId());
+    if (target != Board::NONE) {
+        NodeType type = static_cast<NodeType>(m_board.getEntity(target).kind);
+        player.defendNode(type);
+        logEvent(EventCode::DEFENDED, player.getId(), -1, static_cast<int>(type));
+    }
+}
+
+void GameState::executeSpy(const Action& action, Player& player, Player& /*opponent*/) {
+    NBD_TRACE_SCOPE("GameState::executeSpy");
+    // Gains intel and reveals the area around the target until next turn
+    if (player.isCommsAlive()) {
+        player.addIntelPoints(15);
+        m_visibility.reveal(player.getId(), action.targetPos);
+        logEvent(EventCode::SPIED, player.getId(), -1, 0, 15);
+    } else {
+        logEvent(EventCode::SPY_FAILED, player.getId());
     }
-    
-    return output;
 }
@@ -1,66 +1,180 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <array>
 #include <vector>
 #include <string>
-#include <map>
-#include <memory>
+#include "Action.h"
+#include "ActionJournal.h"
+#include "Board.h"
+#include "BoardView.h"
+#include "CombatKernel.h"
+#include "CoreState.h"
+#include "EventLog.h"
+#include "Metrics.h"
 #include "Player.h"
 #include "Position.h"
-
-enum class GamePhase {
-    PLANNING,
-    EXECUTING,
-    GAME_OVER
-};
+#include "StateCache.h"
+#include "Visibility.h"
 
 class GameState {
 public:
     GameState();
     ~GameState();
+    GameState(GameState&&) = default;
+    GameState& operator=(GameState&&) = default;
+    
+    // Full copies, including names, log and views. Assigning into an
+    // existing state reuses its buffers, so repeated copies do not allocate.
+    GameState(const GameState&) = default;
+    GameState& operator=(const GameState&) = default;
+    
+    // Cheap snapshots of the turn-resolution state (a memcpy; see
+    // CoreState). restore publishes the restored state as a reset, like a
+    // load; names and the log are left as they are.
+    void clone(CoreState& out) const { out = m_core; }
+    bool restore(const CoreState& state);
+    const CoreState& getCoreState() const { return m_core; }
 
     // Game setup
     void initializeGame(const std::string& player1Name, const std::string& player2Name);
     
     // Turn management
-    void submitAction(int playerId, const std::string& actionType, const Position& targetPos);
+    SubmitResult submitAction(int playerId, ActionType actionType, const Position& targetPos,
+                              UnitHandle unit = INVALID_UNIT_HANDLE);
+    // Submits a whole turn packed as ACTION_TUPLE_WORDS int32s per action
+    // (see Action.h) and publishes once. Writes one SubmitResult per action
+    // to results and returns how many were accepted.
+    size_t submitActions(const int32_t* tuples, size_t count, int32_t* results);
     void processActions();
     void endTurn();
     bool isGameOver() const;
     int getWinner() const;
     
+    // Resolves a journaled turn: the actions are queued as already accepted
+    // (no validation, no submission events) and processed
+    bool replayTurn(const Action* actions, size_t count);
+    
+    // Every resolved turn since the last initializeGame, load or restore,
+    // with periodic checkpoints; see ActionJournal::seek for replay
+    const ActionJournal& getJournal() const { return m_journal; }
+    
+    // Actions the player could submit now, one per distinct target
+    void getLegalActions(int playerId, std::vector<Action>& out) const;
+    
     // Getters
-    int getCurrentTurn() const { return m_currentTurn; }
-    GamePhase getGamePhase() const { return m_phase; }
-    const Player& getPlayer(int playerId) const { return *m_players[playerId]; }
-    Player& getPlayerMutable(int playerId) { return *m_players[playerId]; }
-    const std::vector<std::string>& getGameLog() const { return m_gameLog; }
+    int getCurrentTurn() const { return m_core.currentTurn; }
+    GamePhase getGamePhase() const { return m_core.phase; }
+    const Player& getPlayer(int playerId) const { return m_core.players[playerId]; }
+    Player& getPlayerMutable(int playerId) { return m_core.players[playerId]; }
+    const std::string& getPlayerName(int playerId) const { return m_playerNames[playerId]; }
+    
+    // Game log. Entries are stored as compact events and only turned into
+    // text here; sequence numbers count from the start of the match, and
+    // only the most recent EventLog::CAPACITY entries are retained.
+    const EventLog& getEventLog() const { return m_eventLog; }
+    std::vector<std::string> getGameLog() const;
+    void getLogRange(uint32_t fromSequence, uint32_t count, std::vector<std::string>& out) const;
+    void formatEvent(const GameEvent& event, std::string& out) const;
     
     // Game state serialization
     std::string serializeState() const;
-    void deserializeState(const std::string& jsonState);
+    void serializeState(std::string& out, bool compact = false) const;
+    bool deserializeState(const std::string& jsonState);
+    
+    // Compact JSON of the state as one player sees it: the serializeState
+    // layout without the enemy nodes and units it cannot see, the enemy's
+    // intel points or the enemy's own log entries, plus a flat
+    // [x, y, ...] "visibleCells" list
+    const std::string& getPlayerState(int playerId) const;
+    
+    // Memoized serializations. getStateJson, getSnapshot and getPlayerState
+    // encode at most once per state version and otherwise return the cached
+    // buffer; a reference stays valid until the next call for the same form.
+    const std::string& getStateJson(bool compact = true) const;
+    const std::vector<uint8_t>& getSnapshot() const;
+    const StateCache::Stats& getStateCacheStats() const { return m_stateCache.getStats(); }
+    void resetStateCacheStats() { m_stateCache.resetStats(); }
+    
+    // Change tracking. Every mutation path ends by publishing its changes
+    // under a new, monotonically increasing state version; getStateDelta
+    // returns only what changed after a version a client already has.
+    uint32_t getStateVersion() const { return m_stateVersion; }
+    void commitChanges(); // Call after mutating players through getPlayerMutable
+    std::string getStateDelta(uint32_t sinceVersion) const;
+    void getStateDelta(uint32_t sinceVersion, std::string& out) const;
+    
+    // Packed int32 mirror of node/unit state, refreshed on every commit
+    const BoardView& getBoardView() const { return m_boardView; }
+    
+    // Spatial index of nodes and units, re-indexed on every commit
+    const Board& getBoard() const { return m_board; }
+    
+    // Runtime counters (layout in Metrics.h), including the cache counters,
+    // log size and heap use sampled now. resetMetrics also clears the cache
+    // counters.
+    void getMetrics(Metrics::Array& out) const;
+    void resetMetrics();
+    
+    // Cells each player can see, updated on every commit
+    const Visibility& getVisibility() const { return m_visibility; }
+    
+    // Binary snapshots (layout documented in Snapshot.h)
+    void saveSnapshot(std::vector<uint8_t>& out) const;
+    bool loadSnapshot(const uint8_t* data, size_t size);
     
 private:
+    // Lets the native benchmark harness drive the private turn-resolution helpers
+    friend class GameStateBenchmark;
+    
     // Game state
-    int m_currentTurn;
-    GamePhase m_phase;
-    std::vector<std::unique_ptr<Player>> m_players;
-    std::vector<std::string> m_gameLog;
-    int m_winner; // -1 = no winner, 0 = player 1, 1 = player 2
-    
-    // Pending actions
-    struct Action {
-        int playerId;
-        std::string actionType;
-        Position targetPos;
+    CoreState m_core;
+    std::array<std::string, MAX_PLAYERS> m_playerNames;
+    EventLog m_eventLog;
+    ActionJournal m_journal;
+    
+    // Change tracking
+    uint32_t m_stateVersion;
+    uint32_t m_resetVersion; // First version after the last initializeGame/load
+    bool m_hasUncommittedChanges; // Turn, phase or log changed since the last commit
+    BoardView m_boardView;
+    Board m_board;
+    CombatKernel* m_combat = nullptr; // This turn's attacks, on the TurnArena; set only inside processActions
+    Visibility m_visibility;
+    mutable StateCache m_stateCache;
+    mutable Metrics m_metrics;
+    
+    // Per-action validator and executor, looked up by ActionType
+    struct ActionHandler {
+        bool (GameState::*validate)(const Player& player, const Position& targetPos, UnitHandle unit) const;
+        void (GameState::*execute)(const Action& action, Player& player, Player& opponent);
     };
-    std::vector<Action> m_pendingActions;
+    static const ActionHandler& getActionHandler(ActionType type);
     
     // Helper methods
+    void writeState(std::string& out, bool compact, int viewerId) const; // viewerId -1: everything
+    void resolveCombat();
     void checkVictoryConditions();
-    void addToGameLog(const std::string& message);
-    bool isValidAction(int playerId, const std::string& actionType, const Position& targetPos) const;
+    bool hasConsistentState() const;
+    static bool hasConsistentState(const CoreState& core);
+    void adoptLoadedState(GameState&& loaded);
+    void publishAsReset();
+    void logEvent(EventCode code, int actor = -1, int target = -1, int detail = 0, int amount = 0);
+    bool isValidAction(int playerId, ActionType actionType, const Position& targetPos,
+                       UnitHandle unit = INVALID_UNIT_HANDLE) const;
+    SubmitResult queueAction(int playerId, ActionType actionType, const Position& targetPos, UnitHandle unit);
     void executeAction(const Action& action);
     
-    // Helper for simplified JSON serialization
-    std::string escapeJsonString(const std::string& input) const;
+    bool validateMove(const Player& player, const Position& targetPos, UnitHandle unit) const;
+    bool validateAttack(const Player& player, const Position& targetPos, UnitHandle unit) const;
+    bool validateHack(const Player& player, const Position& targetPos, UnitHandle unit) const;
+    bool validateDefend(const Player& player, const Position& targetPos, UnitHandle unit) const;
+    bool validateSpy(const Player& player, const Position& targetPos, UnitHandle unit) const;
+    
+    void executeMove(const Action& action, Player& player, Player& opponent);
+    void executeAttack(const Action& action, Player& player, Player& opponent);
+    void executeHack(const Action& action, Player& player, Player& opponent);
+    void executeDefend(const Action& action, Player& player, Player& opponent);
+    void executeSpy(const Action& action, Player& player, Player& opponent);
 };
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Generational handle: slot index in the low 8 bits, the slot's generation
+// in the 23 bits above it (so handles stay positive as int32). Generations
+// start at 1, so 0 is never a valid handle.
+using UnitHandle = uint32_t;
+
+const UnitHandle INVALID_UNIT_HANDLE = 0;
+const uint32_t MAX_HANDLE_GENERATION = 0x7FFFFF;
+
+constexpr UnitHandle makeUnitHandle(uint32_t slot, uint32_t generation) {
+    return (generation << 8) | slot;
+}
+constexpr uint32_t unitHandleSlot(UnitHandle handle) { return handle & 0xFF; }
+constexpr uint32_t unitHandleGeneration(UnitHandle handle) { return handle >> 8; }
+
+// Slot-map bookkeeping for a dense, fixed-capacity store: maps generational
+// handles to dense indices in O(1). The owner keeps the items themselves (in
+// whatever layout it likes) at indices [0, size()). Inserting appends at
+// index size(); removing moves the last item into the hole, which the owner
+// mirrors. A slot's generation is bumped on removal, so stale handles stop
+// resolving instead of aliasing a newer item. Pointer-free and trivially
+// copyable.
+template <std::size_t Capacity>
+class HandleTable {
+    static_assert(Capacity > 0 && Capacity <= 0xFF, "slot index must fit in 8 bits");
+
+public:
+    HandleTable() { clear(); }
+
+    static constexpr std::size_t capacity() { return Capacity; }
+    std::size_t size() const { return m_size; }
+    bool full() const { return m_size == Capacity; }
+
+    UnitHandle handleAt(std::size_t index) const {
+        uint8_t slot = m_slotOfIndex[index];
+        return makeUnitHandle(slot, m_slots[slot].generation);
+    }
+
+    // Dense index of a live handle, or -1
+    int indexOf(UnitHandle handle) const {
+        uint32_t slot = unitHandleSlot(handle);
+        if (slot >= Capacity || !m_slots[slot].live || m_slots[slot].generation != unitHandleGeneration(handle)) {
+            return -1;
+        }
+        return m_slots[slot].index;
+    }
+
+    // Handle for a new item at index size(), or INVALID_UNIT_HANDLE when full
+    UnitHandle insert() {
+        if (m_freeCount == 0) {
+            return INVALID_UNIT_HANDLE;
+        }
+        return place(m_freeSlots[--m_freeCount]);
+    }
+
+    // Re-creates a known handle (used when loading saved state); fails if
+    // the handle is malformed or its slot is taken
+    bool insertAt(UnitHandle handle) {
+        uint32_t slot = unitHandleSlot(handle);
+        uint32_t generation = unitHandleGeneration(handle);
+        if (slot >= Capacity || generation == 0 || generation > MAX_HANDLE_GENERATION || m_slots[slot].live) {
+            return false;
+        }
+        for (uint32_t i = 0; i < m_freeCount; ++i) {
+            if (m_freeSlots[i] == slot) {
+                m_freeSlots[i] = m_freeSlots[--m_freeCount];
+                break;
+            }
+        }
+        m_slots[slot].generation = generation;
+        place(static_cast<uint8_t>(slot));
+        return true;
+    }
+
+    // Returns the removed item's index, or -1 for a stale handle. Unless it
+    // was the last one, the item at the new size() moves into that index.
+    int remove(UnitHandle handle) {
+        int index = indexOf(handle);
+        if (index < 0) {
+            return -1;
+        }
+        uint8_t slot = m_slotOfIndex[index];
+        uint32_t last = m_size - 1;
+        if (static_cast<uint32_t>(index) != last) {
+            m_slotOfIndex[index] = m_slotOfIndex[last];
+            m_slots[m_slotOfIndex[index]].index = static_cast<uint8_t>(index);
+        }
+        m_size--;
+
+        Slot& freed = m_slots[slot];
+        freed.live = false;
+        freed.generation = freed.generation < MAX_HANDLE_GENERATION ? freed.generation + 1 : 1;
+        m_freeSlots[m_freeCount++] = slot;
+        return index;
+    }
+
+    void clear() {
+        m_size = 0;
+        m_freeCount = static_cast<uint32_t>(Capacity);
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            m_slotOfIndex[i] = 0;
+            m_slots[i] = { 1, 0, false };
+            // Popped from the back, so slot 0 is handed out first
+            m_freeSlots[i] = static_cast<uint8_t>(Capacity - 1 - i);
+        }
+    }
+
+private:
+    struct Slot {
+        uint32_t generation;
+        uint8_t index;      // Dense index while live
+        bool live;
+    };
+
+    uint8_t m_slotOfIndex[Capacity];
+    Slot m_slots[Capacity];
+    uint8_t m_freeSlots[Capacity];
+    uint32_t m_freeCount;
+    uint32_t m_size;
+
+    UnitHandle place(uint8_t slot) {
+        m_slotOfIndex[m_size] = slot;
+        m_slots[slot].index = static_cast<uint8_t>(m_size);
+        m_slots[slot].live = true;
+        m_size++;
+        return makeUnitHandle(slot, m_slots[slot].generation);
+    }
+};
@@ -0,0 +1,284 @@
+#include "JsonReader.h"
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// Recursive-descent parser over a string; kept out of the header so the
+// document model stays small.
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text)
+        : m_text(text.data())
+        , m_end(text.data() + text.size())
+        , m_depth(0)
+    {
+    }
+
+    bool parseDocument(JsonValue& out) {
+        if (!parseValue(out)) {
+            return false;
+        }
+        skipWhitespace();
+        return m_text == m_end;
+    }
+
+private:
+    static const int MAX_DEPTH = 64;
+
+    const char* m_text;
+    const char* m_end;
+    int m_depth;
+
+    void skipWhitespace() {
+        while (m_text < m_end && (*m_text == ' ' || *m_text == '\n' || *m_text == '\r' || *m_text == '\t')) {
+            m_text++;
+        }
+    }
+
+    bool consume(char expected) {
+        skipWhitespace();
+        if (m_text < m_end && *m_text == expected) {
+            m_text++;
+            return true;
+        }
+        return false;
+    }
+
+    bool consumeLiteral(const char* literal) {
+        std::size_t length = std::strlen(literal);
+        if (static_cast<std::size_t>(m_end - m_text) < length || std::memcmp(m_text, literal, length) != 0) {
+            return false;
+        }
+        m_text += length;
+        return true;
+    }
+
+    bool parseValue(JsonValue& out) {
+        skipWhitespace();
+        if (m_text == m_end) {
+            return false;
+        }
+
+        switch (*m_text) {
+            case '{': return parseObject(out);
+            case '[': return parseArray(out);
+            case '"':
+                out.m_type = JsonValue::Type::STRING;
+                return parseString(out.m_text);
+            case 't':
+                out.m_type = JsonValue::Type::BOOL;
+                out.m_bool = true;
+                return consumeLiteral("true");
+            case 'f':
+                out.m_type = JsonValue::Type::BOOL;
+                out.m_bool = false;
+                return consumeLiteral("false");
+            case 'n':
+                out.m_type = JsonValue::Type::NUL;
+                return consumeLiteral("null");
+            default:
+                return parseNumber(out);
+        }
+    }
+
+    bool parseObject(JsonValue& out) {
+        if (++m_depth > MAX_DEPTH) {
+            return false;
+        }
+        out.m_type = JsonValue::Type::OBJECT;
+        m_text++; // '{'
+
+        if (consume('}')) {
+            m_depth--;
+            return true;
+        }
+
+        do {
+            skipWhitespace();
+            std::string key;
+            if (m_text == m_end || *m_text != '"' || !parseString(key) || !consume(':')) {
+                return false;
+            }
+            out.m_members.emplace_back(std::move(key), JsonValue());
+            if (!parseValue(out.m_members.back().second)) {
+                return false;
+            }
+        } while (consume(','));
+
+        m_depth--;
+        return consume('}');
+    }
+
+    bool parseArray(JsonValue& out) {
+        if (++m_depth > MAX_DEPTH) {
+            return false;
+        }
+        out.m_type = JsonValue::Type::ARRAY;
+        m_text++; // '['
+
+        if (consume(']')) {
+            m_depth--;
+            return true;
+        }
+
+        do {
+            out.m_items.emplace_back();
+            if (!parseValue(out.m_items.back())) {
+                return false;
+            }
+        } while (consume(','));
+
+        m_depth--;
+        return consume(']');
+    }
+
+    bool parseNumber(JsonValue& out) {
+        const char* start = m_text;
+        while (m_text < m_end && (std::strchr("+-0123456789.eE", *m_text) != nullptr)) {
+            m_text++;
+        }
+        if (m_text == start) {
+            return false;
+        }
+
+        out.m_type = JsonValue::Type::NUMBER;
+        auto result = std::from_chars(start, m_text, out.m_number);
+        if (result.ptr == m_text) {
+            // An integer too large for long long is rejected, not clamped
+            return result.ec == std::errc();
+        }
+
+        // Fractional or exponent form: truncate to an integer. The cast is
+        // only defined for values in long long's range (NaN fails both tests).
+        std::string token(start, m_text);
+        char* parsedEnd = nullptr;
+        double number = std::strtod(token.c_str(), &parsedEnd);
+        const double limit = -static_cast<double>(std::numeric_limits<long long>::min()); // 2^63
+        if (parsedEnd != token.c_str() + token.size() || !(number >= -limit && number < limit)) {
+            return false;
+        }
+        out.m_number = static_cast<long long>(number);
+        return true;
+    }
+
+    bool parseHex4(unsigned int& codePoint) {
+        if (m_end - m_text < 4) {
+            return false;
+        }
+        auto result = std::from_chars(m_text, m_text + 4, codePoint, 16);
+        if (result.ptr != m_text + 4) {
+            return false;
+        }
+        m_text += 4;
+        return true;
+    }
+
+    static void appendUtf8(std::string& out, unsigned int codePoint) {
+        if (codePoint < 0x80) {
+            out += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    bool parseString(std::string& out) {
+        m_text++; // opening quote
+        out.clear();
+
+        while (m_text < m_end) {
+            char ch = *m_text++;
+            if (ch == '"') {
+                return true;
+            }
+            if (ch != '\\') {
+                out += ch;
+                continue;
+            }
+            if (m_text == m_end) {
+                return false;
+            }
+
+            char escape = *m_text++;
+            switch (escape) {
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    unsigned int codePoint = 0;
+                    if (!parseHex4(codePoint)) {
+                        return false;
+                    }
+                    // Combine UTF-16 surrogate pairs
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF && consumeLiteral("\\u")) {
+                        unsigned int low = 0;
+                        if (!parseHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                            return false;
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, codePoint);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        return false;
+    }
+};
+
+bool JsonValue::parse(const std::string& text, JsonValue& out) {
+    out = JsonValue();
+    JsonParser parser(text);
+    return parser.parseDocument(out);
+}
+
+bool JsonValue::getInt(int& out) const {
+    if (m_type != Type::NUMBER || m_number < std::numeric_limits<int>::min() ||
+        m_number > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    out = static_cast<int>(m_number);
+    return true;
+}
+
+bool JsonValue::getBool(bool& out) const {
+    if (m_type != Type::BOOL) {
+        return false;
+    }
+    out = m_bool;
+    return true;
+}
+
+bool JsonValue::getString(std::string& out) const {
+    if (m_type != Type::STRING) {
+        return false;
+    }
+    out = m_text;
+    return true;
+}
+
+const JsonValue* JsonValue::find(const char* key) const {
+    for (const auto& member : m_members) {
+        if (member.first == key) {
+            return &member.second;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Minimal JSON document model, sufficient for reading back the output of
+// GameState::serializeState. Numbers are kept as integers.
+class JsonValue {
+public:
+    enum class Type {
+        NUL,
+        BOOL,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    JsonValue() : m_type(Type::NUL), m_bool(false), m_number(0) {}
+
+    // Parse a complete document; returns false on malformed input, including
+    // numbers outside the range of long long
+    static bool parse(const std::string& text, JsonValue& out);
+
+    Type getType() const { return m_type; }
+    bool isObject() const { return m_type == Type::OBJECT; }
+    bool isArray() const { return m_type == Type::ARRAY; }
+
+    // Typed accessors return false when the value has a different type;
+    // getInt also when the number does not fit in an int
+    bool getInt(int& out) const;
+    bool getBool(bool& out) const;
+    bool getString(std::string& out) const;
+
+    // Object member lookup; returns nullptr if missing or not an object
+    const JsonValue* find(const char* key) const;
+
+    // Array elements (empty for non-arrays)
+    const std::vector<JsonValue>& getItems() const { return m_items; }
+
+private:
+    friend class JsonParser;
+
+    Type m_type;
+    bool m_bool;
+    long long m_number;
+    std::string m_text;
+    std::vector<JsonValue> m_items;
+    std::vector<std::pair<std::string, JsonValue>> m_members;
+};
@@ -0,0 +1,187 @@
+#include "JsonWriter.h"
+#include <charconv>
+#include <cstring>
+
+JsonWriter::JsonWriter(std::string& buffer, bool compact)
+    : m_buffer(buffer)
+    , m_compact(compact)
+    , m_depth(0)
+    , m_needComma(false)
+    , m_afterKey(false)
+{
+}
+
+void JsonWriter::beginObject() {
+    beginContainer('{');
+}
+
+void JsonWriter::endObject() {
+    endContainer('}');
+}
+
+void JsonWriter::beginArray() {
+    beginContainer('[');
+}
+
+void JsonWriter::endArray() {
+    endContainer(']');
+}
+
+void JsonWriter::value(int number) {
+    value(static_cast<long long>(number));
+}
+
+void JsonWriter::value(unsigned int number) {
+    value(static_cast<unsigned long long>(number));
+}
+
+void JsonWriter::value(long long number) {
+    beginValue();
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    m_buffer.append(digits, result.ptr - digits);
+    m_needComma = true;
+}
+
+void JsonWriter::value(unsigned long long number) {
+    beginValue();
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    m_buffer.append(digits, result.ptr - digits);
+    m_needComma = true;
+}
+
+void JsonWriter::value(double number) {
+    beginValue();
+    char digits[32];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    m_buffer.append(digits, result.ptr - digits);
+    m_needComma = true;
+}
+
+void JsonWriter::value(bool flag) {
+    beginValue();
+    if (flag) {
+        m_buffer.append("true", 4);
+    } else {
+        m_buffer.append("false", 5);
+    }
+    m_needComma = true;
+}
+
+void JsonWriter::value(const char* text) {
+    beginValue();
+    appendQuoted(text, std::strlen(text));
+    m_needComma = true;
+}
+
+void JsonWriter::value(const std::string& text) {
+    beginValue();
+    appendQuoted(text.data(), text.size());
+    m_needComma = true;
+}
+
+void JsonWriter::writeKey(const char* name, std::size_t length) {
+    if (m_needComma) {
+        m_buffer += ',';
+    }
+    newline();
+    appendQuoted(name, length);
+    if (m_compact) {
+        m_buffer += ':';
+    } else {
+        m_buffer.append(": ", 2);
+    }
+    m_needComma = false;
+    m_afterKey = true;
+}
+
+void JsonWriter::beginValue() {
+    // A value directly after its key stays on the key's line
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+
+    if (m_needComma) {
+        m_buffer += ',';
+    }
+    if (m_depth > 0) {
+        newline();
+    }
+}
+
+void JsonWriter::beginContainer(char open) {
+    beginValue();
+    m_buffer += open;
+    m_depth++;
+    m_needComma = false;
+}
+
+void JsonWriter::endContainer(char close) {
+    m_depth--;
+
+    // Only non-empty containers put the closing bracket on its own line
+    if (m_needComma) {
+        newline();
+    }
+    m_buffer += close;
+    m_needComma = true;
+}
+
+void JsonWriter::newline() {
+    if (m_compact) {
+        return;
+    }
+    m_buffer += '\n';
+    m_buffer.append(static_cast<std::size_t>(m_depth) * 2, ' ');
+}
+
+void JsonWriter::appendQuoted(const char* text, std::size_t length) {
+    m_buffer += '"';
+    appendEscaped(m_buffer, text, length);
+    m_buffer += '"';
+}
+
+void JsonWriter::escapeFrom(std::size_t start) {
+    // Text without quotes, backslashes or control characters (the common
+    // case) is already valid; otherwise re-append the rest escaped
+    std::size_t i = start;
+    while (i < m_buffer.size() && m_buffer[i] != '"' && m_buffer[i] != '\\' &&
+           static_cast<unsigned char>(m_buffer[i]) >= 32) {
+        ++i;
+    }
+    if (i == m_buffer.size()) {
+        return;
+    }
+    std::string raw = m_buffer.substr(i);
+    m_buffer.resize(i);
+    appendEscaped(m_buffer, raw.data(), raw.size());
+}
+
+void JsonWriter::appendEscaped(std::string& out, const char* text, std::size_t length) {
+    static const char hexDigits[] = "0123456789abcdef";
+
+    for (std::size_t i = 0; i < length; ++i) {
+        char ch = text[i];
+        switch (ch) {
+            case '\"': out.append("\\\"", 2); break;
+            case '\\': out.append("\\\\", 2); break;
+            case '\b': out.append("\\b", 2); break;
+            case '\f': out.append("\\f", 2); break;
+            case '\n': out.append("\\n", 2); break;
+            case '\r': out.append("\\r", 2); break;
+            case '\t': out.append("\\t", 2); break;
+            default:
+                if (static_cast<unsigned char>(ch) < 32) {
+                    // Control characters
+                    char escaped[6] = { '\\', 'u', '0', '0',
+                                        hexDigits[(ch >> 4) & 0xF], hexDigits[ch & 0xF] };
+                    out.append(escaped, 6);
+                } else {
+                    out += ch;
+                }
+                break;
+        }
+    }
+}
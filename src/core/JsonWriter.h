@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Streaming JSON writer that appends into a caller-owned buffer.
+//
+// Keys are taken as string literals so their length is known at compile
+// time, integers are formatted without going through iostreams/locales, and
+// the writer can emit either indented (2 spaces) or compact output. Reusing
+// the same buffer across calls avoids reallocating once it has grown.
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& buffer, bool compact = false);
+
+    // Containers
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    // Object keys (string literals only)
+    template <std::size_t N>
+    void key(const char (&name)[N]) { writeKey(name, N - 1); }
+
+    // Values
+    void value(int number);
+    void value(unsigned int number);
+    void value(long long number);
+    void value(unsigned long long number);
+    void value(double number); // Shortest round-trip form; not for NaN/infinity
+    void value(bool flag);
+    void value(const char* text);
+    void value(const std::string& text);
+
+    // String value formatted straight into the buffer: fill(buffer) appends
+    // the raw text, which is then escaped in place, so callers need no
+    // scratch string
+    template <typename Fill>
+    void valueFrom(Fill fill) {
+        beginValue();
+        m_buffer += '"';
+        std::size_t start = m_buffer.size();
+        fill(m_buffer);
+        escapeFrom(start);
+        m_buffer += '"';
+        m_needComma = true;
+    }
+
+    // Shorthand for key(name) followed by value(v)
+    template <std::size_t N, typename T>
+    void field(const char (&name)[N], const T& v) {
+        writeKey(name, N - 1);
+        value(v);
+    }
+
+    // Append the JSON-escaped form of text (without quotes) to out
+    static void appendEscaped(std::string& out, const char* text, std::size_t length);
+
+private:
+    std::string& m_buffer;
+    bool m_compact;
+    int m_depth;
+    bool m_needComma;
+    bool m_afterKey;
+
+    void writeKey(const char* name, std::size_t length);
+    void beginValue();
+    void beginContainer(char open);
+    void endContainer(char close);
+    void newline();
+    void appendQuoted(const char* text, std::size_t length);
+    void escapeFrom(std::size_t start);
+};
@@ -0,0 +1,196 @@
+#include "MatchManager.h"
+#include <algorithm>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double microsecondsSince(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+// Nearest-rank percentile; sorts samples in place
+double percentile(std::vector<float>& samples, double fraction) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(fraction * (samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+    return samples[rank];
+}
+
+} // namespace
+
+MatchManager::MatchManager(int workerCount) {
+    if (workerCount < 1) {
+        workerCount = 1;
+    }
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    for (auto& worker : m_workers) {
+        Worker* target = worker.get();
+        worker->thread = std::thread([this, target]() { run(*target); });
+    }
+}
+
+MatchManager::~MatchManager() {
+    for (auto& worker : m_workers) {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->stopping = true;
+        worker->wake.notify_one();
+    }
+    for (auto& worker : m_workers) {
+        worker->thread.join();
+    }
+}
+
+size_t MatchManager::getMatchCount() const {
+    std::lock_guard<std::mutex> lock(m_matchesMutex);
+    return m_matches.size();
+}
+
+uint32_t MatchManager::createMatch(const std::string& player1Name, const std::string& player2Name) {
+    // Set the game up before publishing it, so no worker can see it half built
+    auto match = std::make_unique<Match>();
+    match->game.initializeGame(player1Name, player2Name);
+
+    std::lock_guard<std::mutex> lock(m_matchesMutex);
+    m_matches.push_back(std::move(match));
+    return static_cast<uint32_t>(m_matches.size() - 1);
+}
+
+bool MatchManager::submitAction(uint32_t matchId, int playerId, ActionType actionType, const Position& targetPos) {
+    return enqueue(matchId, { { playerId, actionType, targetPos, INVALID_UNIT_HANDLE }, false, Clock::now() });
+}
+
+bool MatchManager::endTurn(uint32_t matchId) {
+    return enqueue(matchId, { Action(), true, Clock::now() });
+}
+
+bool MatchManager::isMatchOver(uint32_t matchId) const {
+    const Match* match = findMatch(matchId);
+    return match && match->over.load(std::memory_order_acquire);
+}
+
+int MatchManager::getMatchTurn(uint32_t matchId) const {
+    const Match* match = findMatch(matchId);
+    return match ? match->turn.load(std::memory_order_acquire) : 0;
+}
+
+void MatchManager::drain() {
+    std::unique_lock<std::mutex> lock(m_idleMutex);
+    m_idle.wait(lock, [this]() { return m_inFlight.load() == 0; });
+}
+
+const GameState& MatchManager::getMatch(uint32_t matchId) const {
+    return findMatch(matchId)->game;
+}
+
+MatchManagerStats MatchManager::getStats() const {
+    MatchManagerStats stats;
+    std::vector<float> latencies;
+    std::vector<float> resolves;
+    for (const auto& worker : m_workers) {
+        stats.requests += worker->requests;
+        latencies.insert(latencies.end(), worker->latencyUs.begin(), worker->latencyUs.end());
+        resolves.insert(resolves.end(), worker->resolveUs.begin(), worker->resolveUs.end());
+    }
+    stats.turnsResolved = latencies.size();
+    stats.p50LatencyUs = percentile(latencies, 0.50);
+    stats.p99LatencyUs = percentile(latencies, 0.99);
+    stats.maxLatencyUs = latencies.empty() ? 0.0 : *std::max_element(latencies.begin(), latencies.end());
+    stats.p99ResolveUs = percentile(resolves, 0.99);
+    return stats;
+}
+
+void MatchManager::resetStats() {
+    for (auto& worker : m_workers) {
+        worker->requests = 0;
+        worker->latencyUs.clear();
+        worker->resolveUs.clear();
+    }
+}
+
+MatchManager::Match* MatchManager::findMatch(uint32_t matchId) const {
+    std::lock_guard<std::mutex> lock(m_matchesMutex);
+    return matchId < m_matches.size() ? m_matches[matchId].get() : nullptr;
+}
+
+bool MatchManager::enqueue(uint32_t matchId, const Request& request) {
+    Match* match = findMatch(matchId);
+    if (!match) {
+        return false;
+    }
+
+    m_inFlight.fetch_add(1);
+    Worker& worker = *m_workers[matchId % m_workers.size()];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    match->queue.push_back(request);
+    if (!match->scheduled) {
+        match->scheduled = true;
+        worker.ready.push_back(match);
+        worker.wake.notify_one();
+    }
+    return true;
+}
+
+void MatchManager::run(Worker& worker) {
+    std::vector<Match*> ready;
+    std::vector<Request> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.wake.wait(lock, [&worker]() { return worker.stopping || !worker.ready.empty(); });
+            if (worker.ready.empty()) {
+                return;
+            }
+            ready.swap(worker.ready);
+        }
+
+        for (Match* match : ready) {
+            {
+                // Requests arriving while this batch runs reschedule the match
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                batch.swap(match->queue);
+                match->scheduled = false;
+            }
+            process(worker, *match, batch);
+            finishRequests(batch.size());
+            batch.clear();
+        }
+        ready.clear();
+    }
+}
+
+void MatchManager::process(Worker& worker, Match& match, std::vector<Request>& batch) {
+    for (const Request& request : batch) {
+        worker.requests++;
+        if (!request.endTurn) {
+            match.game.submitAction(request.action.playerId, request.action.type, request.action.targetPos, request.action.unit);
+            continue;
+        }
+
+        // Turns ended outside the planning phase are rejected by the game and
+        // would only skew the latency figures
+        bool resolves = match.game.getGamePhase() == GamePhase::PLANNING;
+        Clock::time_point start = Clock::now();
+        match.game.endTurn();
+        Clock::time_point end = Clock::now();
+        if (!resolves) {
+            continue;
+        }
+        worker.latencyUs.push_back(static_cast<float>(microsecondsSince(request.queuedAt, end)));
+        worker.resolveUs.push_back(static_cast<float>(microsecondsSince(start, end)));
+
+        match.turn.store(match.game.getCurrentTurn(), std::memory_order_release);
+        match.over.store(match.game.isGameOver(), std::memory_order_release);
+    }
+}
+
+void MatchManager::finishRequests(uint64_t count) {
+    if (m_inFlight.fetch_sub(count) == count) {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_idle.notify_all();
+    }
+}
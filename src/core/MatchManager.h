@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Action.h"
+#include "GameState.h"
+
+struct MatchManagerStats {
+    uint64_t requests = 0;          // submitAction and endTurn requests processed
+    uint64_t turnsResolved = 0;
+    double p50LatencyUs = 0.0;      // endTurn enqueue to resolution finished
+    double p99LatencyUs = 0.0;
+    double maxLatencyUs = 0.0;
+    double p99ResolveUs = 0.0;      // processActions alone, without queueing
+};
+
+// Native host for many concurrent matches. Each match is owned by one worker
+// thread (match id modulo the worker count), so a match never runs on two
+// threads at once and GameState needs no locking. Requests are appended to
+// the match's own queue; a worker drains whole queues of the matches that
+// became ready, in arrival order.
+//
+// Request calls and createMatch may come from any number of threads. Reading
+// a match through getMatch is only safe once drain() has returned and no
+// requests are in flight. Not part of the Wasm build.
+class MatchManager {
+public:
+    static const uint32_t INVALID_MATCH = UINT32_MAX;
+
+    explicit MatchManager(int workerCount);
+    ~MatchManager();
+
+    MatchManager(const MatchManager&) = delete;
+    MatchManager& operator=(const MatchManager&) = delete;
+
+    int getWorkerCount() const { return static_cast<int>(m_workers.size()); }
+    size_t getMatchCount() const;
+
+    // Starts a new game and returns its id
+    uint32_t createMatch(const std::string& player1Name, const std::string& player2Name);
+
+    // Queue a request; false if the match does not exist. Invalid actions are
+    // rejected later by the match itself, exactly as in a local game.
+    bool submitAction(uint32_t matchId, int playerId, ActionType actionType, const Position& targetPos);
+    bool endTurn(uint32_t matchId);
+
+    // Lock-free progress checks, updated after each resolved turn
+    bool isMatchOver(uint32_t matchId) const;
+    int getMatchTurn(uint32_t matchId) const;
+
+    // Blocks until every queued request has been processed
+    void drain();
+
+    const GameState& getMatch(uint32_t matchId) const;
+
+    // Aggregated over all workers; call after drain(). Latency samples
+    // accumulate until resetStats.
+    MatchManagerStats getStats() const;
+    void resetStats();
+
+private:
+    struct Request {
+        Action action;
+        bool endTurn;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+
+    struct Match {
+        GameState game;
+        std::vector<Request> queue;     // Guarded by the owning worker's mutex
+        bool scheduled = false;         // Already in the worker's ready list
+        std::atomic<bool> over{ false };
+        std::atomic<int> turn{ 1 };
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::vector<Match*> ready;
+        bool stopping = false;
+        std::thread thread;
+
+        // Only touched by the worker thread (and by getStats after drain)
+        uint64_t requests = 0;
+        std::vector<float> latencyUs;
+        std::vector<float> resolveUs;
+    };
+
+    mutable std::mutex m_matchesMutex;
+    std::vector<std::unique_ptr<Match>> m_matches;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    std::mutex m_idleMutex;
+    std::condition_variable m_idle;
+    std::atomic<uint64_t> m_inFlight{ 0 };
+
+    Match* findMatch(uint32_t matchId) const;
+    bool enqueue(uint32_t matchId, const Request& request);
+    void run(Worker& worker);
+    void process(Worker& worker, Match& match, std::vector<Request>& batch);
+    void finishRequests(uint64_t count);
+};
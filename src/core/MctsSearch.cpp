@@ -0,0 +1,205 @@
+#include "MctsSearch.h"
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+const int ROOT = 0;
+const int TIME_CHECK_INTERVAL = 64;
+
+double nodeHealthFraction(const Player& player) {
+    int hp = 0;
+    int maxHp = 0;
+    for (const auto& node : player.getNodes()) {
+        hp += node.getHp() > 0 ? node.getHp() : 0;
+        maxHp += node.getMaxHp();
+    }
+    return maxHp > 0 ? static_cast<double>(hp) / maxHp : 0.0;
+}
+
+} // namespace
+
+MctsSearch::MctsSearch(const MctsConfig& config)
+    : m_config(config)
+    , m_rng(config.seed)
+    , m_player(0)
+    , m_decisionsThisTurn(0)
+{
+}
+
+void MctsSearch::search(const GameState& root, int playerId, std::vector<Action>& out) {
+    out.clear();
+    m_stats = MctsStats();
+    if (playerId < 0 || playerId >= MAX_PLAYERS) {
+        return;
+    }
+    m_player = playerId;
+    m_rng.seed(m_config.seed);
+
+    m_tree.clear();
+    m_tree.push_back({ -1, -1, 0, 0, 0.0, { playerId, ActionType::SPY, Position(), INVALID_UNIT_HANDLE } });
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    auto elapsedMs = [&start]() {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+    bool timeLimited = m_config.timeLimitMs > 0.0;
+    bool iterationLimited = m_config.iterations > 0 || !timeLimited;
+
+    // One full copy per search; iterations only reset the core state, so the
+    // root's log and journal are not copied again for every playout
+    m_scratch = root;
+    root.clone(m_rootCore);
+
+    for (int iteration = 0; ; ++iteration) {
+        if (iterationLimited && iteration >= m_config.iterations) {
+            break;
+        }
+        if (timeLimited && iteration % TIME_CHECK_INTERVAL == 0 && elapsedMs() >= m_config.timeLimitMs) {
+            break;
+        }
+
+        m_scratch.restore(m_rootCore);
+        m_decisionsThisTurn = 0;
+
+        // Selection: descend through expanded nodes, expanding the first leaf
+        // that has been visited before
+        int nodeIndex = ROOT;
+        while (!m_scratch.isGameOver()) {
+            TreeNode& node = m_tree[nodeIndex];
+            if (node.firstChild < 0) {
+                if (node.visits == 0 && nodeIndex != ROOT) {
+                    break;
+                }
+                expand(nodeIndex);
+            }
+            if (m_tree[nodeIndex].childCount == 0) {
+                break;
+            }
+            nodeIndex = selectChild(m_tree[nodeIndex]);
+            applyDecision(m_tree[nodeIndex].action);
+        }
+
+        double reward = playout();
+
+        for (int index = nodeIndex; index >= 0; index = m_tree[index].parent) {
+            m_tree[index].visits++;
+            m_tree[index].totalReward += reward;
+        }
+        m_stats.iterations++;
+    }
+
+    // Follow the most visited children for this turn's decisions
+    int nodeIndex = ROOT;
+    for (int decision = 0; decision < m_config.actionsPerTurn; ++decision) {
+        const TreeNode& node = m_tree[nodeIndex];
+        int best = -1;
+        for (int child = node.firstChild; child >= 0 && child < node.firstChild + node.childCount; ++child) {
+            if (best < 0 || m_tree[child].visits > m_tree[best].visits) {
+                best = child;
+            }
+        }
+        if (best < 0 || m_tree[best].visits == 0) {
+            break;
+        }
+        out.push_back(m_tree[best].action);
+        nodeIndex = best;
+    }
+
+    m_stats.treeNodes = static_cast<int>(m_tree.size());
+    m_stats.elapsedMs = elapsedMs();
+}
+
+int MctsSearch::selectChild(const TreeNode& node) const {
+    // UCT; unvisited children are tried first, in order
+    double logVisits = std::log(static_cast<double>(node.visits > 0 ? node.visits : 1));
+    int best = node.firstChild;
+    double bestScore = -1.0;
+    for (int child = node.firstChild; child < node.firstChild + node.childCount; ++child) {
+        const TreeNode& candidate = m_tree[child];
+        if (candidate.visits == 0) {
+            return child;
+        }
+        double score = candidate.totalReward / candidate.visits +
+                       m_config.exploration * std::sqrt(logVisits / candidate.visits);
+        if (score > bestScore) {
+            bestScore = score;
+            best = child;
+        }
+    }
+    return best;
+}
+
+void MctsSearch::expand(int nodeIndex) {
+    m_scratch.getLegalActions(m_player, m_actions);
+
+    int firstChild = static_cast<int>(m_tree.size());
+    for (const Action& action : m_actions) {
+        m_tree.push_back({ nodeIndex, -1, 0, 0, 0.0, action });
+    }
+
+    // m_tree may have grown, so index rather than hold a reference
+    m_tree[nodeIndex].firstChild = firstChild;
+    m_tree[nodeIndex].childCount = static_cast<int>(m_actions.size());
+}
+
+void MctsSearch::applyDecision(const Action& action) {
+    m_scratch.submitAction(action.playerId, action.type, action.targetPos, action.unit);
+    m_decisionsThisTurn++;
+    if (m_decisionsThisTurn < m_config.actionsPerTurn) {
+        return;
+    }
+
+    for (int i = 0; i < m_config.actionsPerTurn; ++i) {
+        playRandomAction(1 - m_player);
+    }
+    m_scratch.endTurn();
+    m_decisionsThisTurn = 0;
+}
+
+void MctsSearch::playRandomAction(int playerId) {
+    m_scratch.getLegalActions(playerId, m_actions);
+    if (m_actions.empty()) {
+        return;
+    }
+    std::uniform_int_distribution<size_t> pick(0, m_actions.size() - 1);
+    const Action& action = m_actions[pick(m_rng)];
+    m_scratch.submitAction(action.playerId, action.type, action.targetPos, action.unit);
+}
+
+double MctsSearch::playout() {
+    // Finish the turn the tree stopped in, then play whole random turns
+    while (m_decisionsThisTurn > 0 && !m_scratch.isGameOver()) {
+        m_scratch.getLegalActions(m_player, m_actions);
+        if (m_actions.empty()) {
+            break;
+        }
+        std::uniform_int_distribution<size_t> pick(0, m_actions.size() - 1);
+        applyDecision(m_actions[pick(m_rng)]);
+    }
+
+    for (int turn = 0; turn < m_config.playoutTurns && !m_scratch.isGameOver(); ++turn) {
+        for (int i = 0; i < m_config.actionsPerTurn; ++i) {
+            playRandomAction(m_player);
+        }
+        for (int i = 0; i < m_config.actionsPerTurn; ++i) {
+            playRandomAction(1 - m_player);
+        }
+        m_scratch.endTurn();
+    }
+
+    return evaluate();
+}
+
+double MctsSearch::evaluate() const {
+    if (m_scratch.isGameOver()) {
+        int winner = m_scratch.getWinner();
+        return winner == m_player ? 1.0 : (winner < 0 ? 0.5 : 0.0);
+    }
+
+    // Unfinished: compare how much of each side's infrastructure survives
+    double own = nodeHealthFraction(m_scratch.getPlayer(m_player));
+    double enemy = nodeHealthFraction(m_scratch.getPlayer(1 - m_player));
+    return 0.5 + 0.5 * (own - enemy);
+}
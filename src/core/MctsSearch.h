@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Action.h"
+#include "GameState.h"
+
+struct MctsConfig {
+    int iterations = 10000;         // Playout budget; <= 0 means time limit only
+    double timeLimitMs = 0.0;       // Wall-clock budget; <= 0 means iterations only
+    int actionsPerTurn = 1;         // Actions each player submits per turn
+    int playoutTurns = 20;          // Turns simulated past the tree before scoring
+    double exploration = 1.41;      // UCT exploration constant
+    uint32_t seed = 1;
+};
+
+struct MctsStats {
+    int iterations = 0;
+    int treeNodes = 0;
+    double elapsedMs = 0.0;
+};
+
+// Open-loop Monte Carlo Tree Search over one player's actions. Tree nodes are
+// that player's successive decisions; the opponent plays uniformly random
+// legal actions, and every turn is resolved by the real GameState code.
+//
+// The searcher owns all scratch state (tree, a reusable GameState that is
+// reset from a CoreState clone of the root each iteration, action buffers),
+// so after the first search on a given budget, playouts run without
+// allocating. Reuse one instance across searches.
+class MctsSearch {
+public:
+    explicit MctsSearch(const MctsConfig& config = MctsConfig());
+
+    void setConfig(const MctsConfig& config) { m_config = config; }
+    const MctsConfig& getConfig() const { return m_config; }
+
+    // Best actionsPerTurn actions for playerId in the current planning phase;
+    // empty if the player has nothing to do or is not a valid player id
+    void search(const GameState& root, int playerId, std::vector<Action>& out);
+
+    const MctsStats& getStats() const { return m_stats; }
+
+private:
+    struct TreeNode {
+        int parent;
+        int firstChild;     // Children are contiguous; -1 until expanded
+        int childCount;
+        int visits;
+        double totalReward;
+        Action action;      // Action that led here
+    };
+
+    MctsConfig m_config;
+    MctsStats m_stats;
+    std::mt19937 m_rng;
+    std::vector<TreeNode> m_tree;
+    std::vector<Action> m_actions;
+    GameState m_scratch;
+    CoreState m_rootCore;
+    int m_player;
+    int m_decisionsThisTurn;
+
+    int selectChild(const TreeNode& node) const;
+    void expand(int nodeIndex);
+    void applyDecision(const Action& action);
+    void playRandomAction(int playerId);
+    double playout();
+    double evaluate() const;
+};
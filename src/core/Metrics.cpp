@@ -0,0 +1,72 @@
+#include "Metrics.h"
+#include <chrono>
+
+#if defined(__EMSCRIPTEN__) || defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace {
+
+double toMicroseconds(uint64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+
+} // namespace
+
+uint64_t Metrics::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+size_t Metrics::heapBytesInUse() {
+#if defined(__EMSCRIPTEN__)
+    return static_cast<size_t>(mallinfo().uordblks);
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void Metrics::recordSubmit(ActionType type, SubmitResult result) {
+    size_t slot = static_cast<size_t>(type) < ACTION_SLOTS ? static_cast<size_t>(type) : ACTION_SLOTS - 1;
+    if (result == SubmitResult::ACCEPTED) {
+        m_accepted[slot]++;
+    } else {
+        m_rejected[slot]++;
+    }
+}
+
+void Metrics::recordTurn(uint64_t nanoseconds) {
+    m_turns++;
+    m_turnTimeTotal += nanoseconds;
+    m_turnTimeMax = nanoseconds > m_turnTimeMax ? nanoseconds : m_turnTimeMax;
+
+    // Bucket index is the bit length of the whole microseconds
+    uint64_t micros = nanoseconds / 1000;
+    size_t bucket = micros ? static_cast<size_t>(64 - __builtin_clzll(micros)) : 0;
+    m_turnTimeHistogram[bucket < TURN_TIME_BUCKETS ? bucket : TURN_TIME_BUCKETS - 1]++;
+}
+
+void Metrics::recordSerialization(size_t bytes, uint64_t nanoseconds) {
+    m_serializations++;
+    m_serializedBytes += bytes;
+    m_serializationTime += nanoseconds;
+}
+
+void Metrics::write(Array& out) const {
+    out[WORD_LAYOUT_VERSION] = LAYOUT_VERSION;
+    for (size_t i = 0; i < ACTION_SLOTS; ++i) {
+        out[WORD_ACCEPTED + i] = static_cast<double>(m_accepted[i]);
+        out[WORD_REJECTED + i] = static_cast<double>(m_rejected[i]);
+    }
+    out[WORD_TURNS] = static_cast<double>(m_turns);
+    out[WORD_TURN_TIME_TOTAL] = toMicroseconds(m_turnTimeTotal);
+    out[WORD_TURN_TIME_MAX] = toMicroseconds(m_turnTimeMax);
+    for (size_t i = 0; i < TURN_TIME_BUCKETS; ++i) {
+        out[WORD_TURN_TIME_HISTOGRAM + i] = static_cast<double>(m_turnTimeHistogram[i]);
+    }
+    out[WORD_SERIALIZATIONS] = static_cast<double>(m_serializations);
+    out[WORD_SERIALIZED_BYTES] = static_cast<double>(m_serializedBytes);
+    out[WORD_SERIALIZATION_TIME] = toMicroseconds(m_serializationTime);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "Action.h"
+
+// Always-on runtime counters for a GameState: submissions per action type,
+// turn resolution times, and serialization volume and time. Recording is a
+// few integer updates plus, for timed operations, two clock reads.
+//
+// GameState::getMetrics exports them together with values sampled on
+// demand (cache counters, log size, heap and turn arena use) as a flat array of doubles in
+// the Word layout below; times are in microseconds.
+class Metrics {
+public:
+    static constexpr int LAYOUT_VERSION = 2;
+
+    // One slot per ActionType plus a last one for unknown action codes
+    static constexpr size_t ACTION_SLOTS = static_cast<size_t>(ActionType::COUNT) + 1;
+
+    // Turn time histogram: bucket 0 counts turns under 1 us, bucket b turns
+    // in [2^(b-1), 2^b) us; the last bucket is open-ended
+    static constexpr size_t TURN_TIME_BUCKETS = 16;
+
+    enum Word {
+        WORD_LAYOUT_VERSION = 0,
+        WORD_ACCEPTED = 1,                                  // ACTION_SLOTS words
+        WORD_REJECTED = WORD_ACCEPTED + ACTION_SLOTS,       // ACTION_SLOTS words
+        WORD_TURNS = WORD_REJECTED + ACTION_SLOTS,
+        WORD_TURN_TIME_TOTAL,
+        WORD_TURN_TIME_MAX,
+        WORD_TURN_TIME_HISTOGRAM,                           // TURN_TIME_BUCKETS words
+        WORD_SERIALIZATIONS = WORD_TURN_TIME_HISTOGRAM + TURN_TIME_BUCKETS,
+        WORD_SERIALIZED_BYTES,
+        WORD_SERIALIZATION_TIME,
+        WORD_CACHE_HITS,
+        WORD_CACHE_MISSES,
+        WORD_LOG_ENTRIES,                                   // Retained entries
+        WORD_LOG_TOTAL,                                     // Entries since the match started
+        WORD_HEAP_BYTES,                                    // 0 where unknown
+        WORD_ARENA_PEAK_BYTES,                              // Largest turn, per thread
+        WORD_ARENA_HEAP_ALLOCATIONS,                        // Turn arena overflows, per thread
+        WORD_COUNT
+    };
+
+    using Array = std::array<double, WORD_COUNT>;
+
+    // Monotonic clock for the timed records, in nanoseconds
+    static uint64_t now();
+
+    // Bytes of heap currently allocated, or 0 when the allocator cannot say
+    static size_t heapBytesInUse();
+
+    void recordSubmit(ActionType type, SubmitResult result);
+    void recordTurn(uint64_t nanoseconds);
+    void recordSerialization(size_t bytes, uint64_t nanoseconds);
+    void reset() { *this = Metrics(); }
+
+    // Fills the words this class owns; the sampled ones are left alone
+    void write(Array& out) const;
+
+private:
+    std::array<uint64_t, ACTION_SLOTS> m_accepted{};
+    std::array<uint64_t, ACTION_SLOTS> m_rejected{};
+    uint64_t m_turns = 0;
+    uint64_t m_turnTimeTotal = 0; // Nanoseconds
+    uint64_t m_turnTimeMax = 0;
+    std::array<uint64_t, TURN_TIME_BUCKETS> m_turnTimeHistogram{};
+    uint64_t m_serializations = 0;
+    uint64_t m_serializedBytes = 0;
+    uint64_t m_serializationTime = 0; // Nanoseconds
+};
@@ -6,6 +6,8 @@ Node::Node()
     , m_hp(0)
     , m_maxHp(0)
     , m_defended(false)
+    , m_dirty(true)
+    , m_version(0)
 {
 }
 
@@ -15,11 +17,13 @@ Node::Node(NodeType type, const Position& position, int hp, int maxHp)
     , m_hp(hp)
     , m_maxHp(maxHp)
     , m_defended(false)
+    , m_dirty(true)
+    , m_version(0)
 {
 }
 
-std::string Node::getTypeName() const {
-    switch (m_type) {
+const char* getNodeTypeName(NodeType type) {
+    switch (type) {
         case NodeType::CORE:
             return "core";
         case NodeType::COMMS:
@@ -31,6 +35,10 @@ std::string Node::getTypeName() const {
     }
 }
 
+const char* Node::getTypeName() const {
+    return getNodeTypeName(m_type);
+}
+
 void Node::damage(int amount) {
     // If node is defended, reduce damage by 50%
     if (m_defended) {
@@ -43,6 +51,7 @@ void Node::damage(int amount) {
     
     // Apply damage
     m_hp -= amount;
+    m_dirty = true;
     
     // Ensure HP doesn't go below 0
     if (m_hp < 0) {
@@ -57,6 +66,7 @@ void Node::heal(int amount) {
     
     // Apply healing
     m_hp += amount;
+    m_dirty = true;
     
     // Ensure HP doesn't exceed max HP
     if (m_hp > m_maxHp) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Position.h"
+#include <cstdint>
 #include <string>
 
 enum class NodeType {
@@ -9,6 +10,8 @@ enum class NodeType {
     RD
 };
 
+const char* getNodeTypeName(NodeType type);
+
 class Node {
 public:
     Node();
@@ -16,26 +19,35 @@ public:
     
     // Getters
     NodeType getType() const { return m_type; }
-    std::string getTypeName() const;
+    const char* getTypeName() const;
     const Position& getPosition() const { return m_position; }
     int getHp() const { return m_hp; }
     int getMaxHp() const { return m_maxHp; }
     bool isDefended() const { return m_defended; }
     
     // Setters
-    void setPosition(const Position& position) { m_position = position; }
-    void setHp(int hp) { m_hp = (hp > m_maxHp) ? m_maxHp : ((hp < 0) ? 0 : hp); }
-    void setMaxHp(int maxHp) { m_maxHp = maxHp; }
-    void setDefended(bool defended) { m_defended = defended; }
+    void setPosition(const Position& position) { m_position = position; m_dirty = true; }
+    void setHp(int hp) { m_hp = (hp > m_maxHp) ? m_maxHp : ((hp < 0) ? 0 : hp); m_dirty = true; }
+    void setMaxHp(int maxHp) { m_maxHp = maxHp; m_dirty = true; }
+    void setDefended(bool defended) { m_defended = defended; m_dirty = true; }
     
     // Actions
     void damage(int amount);
     void heal(int amount);
     
+    // Change tracking: mutators mark the node dirty, commitChanges stamps
+    // it with the state version the change was published in
+    bool isDirty() const { return m_dirty; }
+    void markDirty() { m_dirty = true; }
+    uint32_t getVersion() const { return m_version; }
+    void commitChanges(uint32_t version) { if (m_dirty) { m_version = version; m_dirty = false; } }
+    
 private:
     NodeType m_type;
     Position m_position;
     int m_hp;
     int m_maxHp;
     bool m_defended;
+    bool m_dirty;
+    uint32_t m_version;
 };
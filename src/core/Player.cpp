@@ -1,26 +1,39 @@
 #include "Player.h"
-#include <chrono>
+#include <cstdlib>
 
-Player::Player(int id, const std::string& name)
+Player::Player()
+    : Player(0)
+{
+}
+
+Player::Player(int id)
     : m_id(id)
-    , m_name(name)
     , m_intelPoints(100)
-    , m_longRangeUnit(Position(0, 0), 0, "")
+    , m_nodeMask(0)
+    , m_aliveMask(0)
+    , m_dirty(true)
+    , m_version(0)
 {
+    m_units.add(UnitKind::LONG_RANGE, Position(0, 0), 0);
 }
 
-Player::~Player() {
+const Node& Player::NodeView::operator[](size_t index) const {
+    uint32_t mask = m_mask;
+    for (; index > 0; --index) {
+        mask &= mask - 1;
+    }
+    return m_nodes[__builtin_ctz(mask)];
 }
 
 void Player::initializeNodes(const Position& corePos, const Position& commsPos, const Position& rdPos) {
     // Create Core node
-    m_nodes[NodeType::CORE] = Node(NodeType::CORE, corePos, 50, 50);
+    addNode(Node(NodeType::CORE, corePos, 50, 50));
     
     // Create Comms node
-    m_nodes[NodeType::COMMS] = Node(NodeType::COMMS, commsPos, 50, 50);
+    addNode(Node(NodeType::COMMS, commsPos, 50, 50));
     
     // Create R&D node
-    m_nodes[NodeType::RD] = Node(NodeType::RD, rdPos, 50, 50);
+    addNode(Node(NodeType::RD, rdPos, 50, 50));
 }
 
 void Player::addNode(const std::string& typeStr, const Position& pos, int hp, int maxHp, bool defended) {
@@ -41,92 +54,144 @@ void Player::addNode(const std::string& typeStr, const Position& pos, int hp, in
         node.setDefended(true);
     }
     
-    m_nodes[type] = node;
+    addNode(node);
+}
+
+void Player::addNode(const Node& node) {
+    // A node of an existing type replaces it
+    NodeType type = node.getType();
+    m_nodes[static_cast<size_t>(type)] = node;
+    m_nodeMask |= nodeBit(type);
+    updateAlive(type);
 }
 
 void Player::damageNode(NodeType type, int amount) {
-    auto it = m_nodes.find(type);
-    if (it != m_nodes.end()) {
-        it->second.damage(amount);
+    if (m_nodeMask & nodeBit(type)) {
+        m_nodes[static_cast<size_t>(type)].damage(amount);
+        updateAlive(type);
     }
 }
 
 void Player::healNode(NodeType type, int amount) {
-    auto it = m_nodes.find(type);
-    if (it != m_nodes.end()) {
-        it->second.heal(amount);
+    if (m_nodeMask & nodeBit(type)) {
+        m_nodes[static_cast<size_t>(type)].heal(amount);
+        updateAlive(type);
     }
 }
 
 void Player::defendNode(NodeType type) {
-    auto it = m_nodes.find(type);
-    if (it != m_nodes.end()) {
-        it->second.setDefended(true);
+    if (m_nodeMask & nodeBit(type)) {
+        m_nodes[static_cast<size_t>(type)].setDefended(true);
     }
 }
 
-void Player::addInfantryGroup(const Position& pos, int count, const std::string& id) {
-    std::string unitId = id.empty() ? generateUnitId("inf") : id;
-    InfantryGroup infantry(pos, count, unitId);
-    m_infantryGroups.push_back(infantry);
+void Player::updateAlive(NodeType type) {
+    if (m_nodes[static_cast<size_t>(type)].getHp() > 0) {
+        m_aliveMask |= nodeBit(type);
+    } else {
+        m_aliveMask &= ~nodeBit(type);
+    }
 }
 
-void Player::updateInfantryStats(const std::string& id, int hp, int maxHp) {
-    for (auto& infantry : m_infantryGroups) {
-        if (infantry.getId() == id) {
-            infantry.setHp(hp);
-            infantry.setMaxHp(maxHp);
-            break;
-        }
+UnitHandle Player::addInfantryGroup(const Position& pos, int count, UnitHandle handle) {
+    if (m_units.full()) {
+        return INVALID_UNIT_HANDLE;
+    }
+    // Never let a loaded infantry handle claim the long range unit's slot
+    if (handle == LONG_RANGE_UNIT_HANDLE) {
+        handle = INVALID_UNIT_HANDLE;
+    }
+    return m_units.add(UnitKind::INFANTRY, pos, count, handle);
+}
+
+bool Player::removeInfantryGroup(UnitHandle handle) {
+    if (handle == LONG_RANGE_UNIT_HANDLE || !m_units.remove(handle)) {
+        return false;
     }
+    m_dirty = true;
+    return true;
 }
 
-void Player::setLongRangeUnit(const Position& pos, int count, const std::string& id) {
-    std::string unitId = id.empty() ? generateUnitId("lr") : id;
-    m_longRangeUnit = LongRangeUnit(pos, count, unitId);
+UnitHandle Player::splitInfantryGroup(UnitHandle handle, int count) {
+    int index = m_units.indexOf(handle);
+    if (index < 0 || m_units.getKind(index) != UnitKind::INFANTRY) {
+        return INVALID_UNIT_HANDLE;
+    }
+    return m_units.split(index, count);
+}
+
+void Player::setLongRangeUnit(const Position& pos, int count) {
+    m_units.setPosition(0, pos);
+    m_units.setCount(0, count);
+    m_units.setMaxHp(0, count * UNIT_HP);
+    m_units.setHp(0, count * UNIT_HP);
 }
 
-void Player::updateLongRangeStats(int hp, int maxHp) {
-    m_longRangeUnit.setHp(hp);
-    m_longRangeUnit.setMaxHp(maxHp);
+void Player::updateUnitStats(UnitHandle handle, int hp, int maxHp) {
+    int index = m_units.indexOf(handle);
+    if (index >= 0) {
+        m_units.setMaxHp(index, maxHp);
+        m_units.setHp(index, hp);
+    }
 }
 
 void Player::addIntelPoints(int amount) {
     m_intelPoints += amount;
+    m_dirty = true;
 }
 
 void Player::spendIntelPoints(int amount) {
     if (m_intelPoints >= amount) {
         m_intelPoints -= amount;
+        m_dirty = true;
     }
 }
 
-bool Player::isCoreAlive() const {
-    auto it = m_nodes.find(NodeType::CORE);
-    if (it != m_nodes.end()) {
-        return it->second.getHp() > 0;
+bool Player::hasPendingChanges() const {
+    if (m_dirty || m_units.hasPendingChanges()) {
+        return true;
+    }
+    for (const auto& node : getNodes()) {
+        if (node.isDirty()) {
+            return true;
+        }
     }
     return false;
 }
 
-bool Player::isCommsAlive() const {
-    auto it = m_nodes.find(NodeType::COMMS);
-    if (it != m_nodes.end()) {
-        return it->second.getHp() > 0;
+void Player::commitChanges(uint32_t version) {
+    if (m_dirty) {
+        m_version = version;
+        m_dirty = false;
     }
-    return false;
+    for (auto& node : m_nodes) {
+        node.commitChanges(version);
+    }
+    m_units.commitChanges(version);
 }
 
-bool Player::isRDLabAlive() const {
-    auto it = m_nodes.find(NodeType::RD);
-    if (it != m_nodes.end()) {
-        return it->second.getHp() > 0;
+void Player::markAllDirty() {
+    m_dirty = true;
+    for (auto& node : m_nodes) {
+        node.markDirty();
     }
-    return false;
+    m_units.markAllDirty();
+}
+
+std::string formatUnitId(int playerId, bool longRange, UnitHandle handle) {
+    return "p" + std::to_string(playerId) + (longRange ? "-lr-" : "-inf-") + std::to_string(handle);
 }
 
-std::string Player::generateUnitId(const std::string& prefix) const {
-    auto now = std::chrono::system_clock::now();
-    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-    return "p" + std::to_string(m_id) + "-" + prefix + "-" + std::to_string(millis);
+UnitHandle parseUnitId(const std::string& text) {
+    std::string::size_type dash = text.rfind('-');
+    if (dash == std::string::npos || dash + 1 >= text.size() || text.size() - dash - 1 > 10) {
+        return INVALID_UNIT_HANDLE;
+    }
+    char* end = nullptr;
+    unsigned long long handle = std::strtoull(text.c_str() + dash + 1, &end, 10);
+    // Ids from older saves (serials, timestamps) carry no generation
+    if (*end != '\0' || handle > UINT32_MAX || unitHandleGeneration(static_cast<UnitHandle>(handle)) == 0) {
+        return INVALID_UNIT_HANDLE;
+    }
+    return static_cast<UnitHandle>(handle);
 }
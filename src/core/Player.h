@@ -1,56 +1,123 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
-#include <vector>
-#include <map>
 #include "Node.h"
-#include "InfantryGroup.h"
-#include "LongRangeUnit.h"
+#include "UnitStore.h"
 
+const std::size_t NODE_TYPE_COUNT = 3;
+
+// Bit for a node type in Player's node masks
+constexpr uint32_t nodeBit(NodeType type) { return 1u << static_cast<int>(type); }
+
+// The long range unit is added first and never removed, so it always holds
+// the first handle and index 0 of the unit store; infantry follow it
+const UnitHandle LONG_RANGE_UNIT_HANDLE = makeUnitHandle(0, 1);
+const std::size_t FIRST_INFANTRY_INDEX = 1;
+
+// A player's nodes, units and resources. Storage is fixed-capacity and
+// pointer-free so the whole player is trivially copyable; the display name
+// is kept by GameState.
 class Player {
 public:
-    Player(int id, const std::string& name);
-    ~Player();
-    
+    using NodeArray = std::array<Node, NODE_TYPE_COUNT>;
+
+    // The nodes a player has, in NodeType order. Nodes live in a fixed array
+    // indexed by type; the view skips types the player does not have.
+    class NodeView {
+    public:
+        class Iterator {
+        public:
+            Iterator(const Node* nodes, uint32_t mask) : m_nodes(nodes), m_mask(mask) {}
+            const Node& operator*() const { return m_nodes[__builtin_ctz(m_mask)]; }
+            const Node* operator->() const { return &m_nodes[__builtin_ctz(m_mask)]; }
+            Iterator& operator++() { m_mask &= m_mask - 1; return *this; }
+            bool operator!=(const Iterator& other) const { return m_mask != other.m_mask; }
+
+        private:
+            const Node* m_nodes;
+            uint32_t m_mask;
+        };
+
+        NodeView(const Node* nodes, uint32_t mask) : m_nodes(nodes), m_mask(mask) {}
+        Iterator begin() const { return Iterator(m_nodes, m_mask); }
+        Iterator end() const { return Iterator(m_nodes, 0); }
+        size_t size() const { return static_cast<size_t>(__builtin_popcount(m_mask)); }
+        bool empty() const { return m_mask == 0; }
+        const Node& operator[](size_t index) const; // index-th node present
+
+    private:
+        const Node* m_nodes;
+        uint32_t m_mask;
+    };
+
+    Player();
+    explicit Player(int id);
+
     // Getters
     int getId() const { return m_id; }
-    const std::string& getName() const { return m_name; }
     int getIntelPoints() const { return m_intelPoints; }
-    const std::map<NodeType, Node>& getNodes() const { return m_nodes; }
-    const std::vector<InfantryGroup>& getInfantryGroups() const { return m_infantryGroups; }
-    const LongRangeUnit& getLongRangeUnit() const { return m_longRangeUnit; }
-    
+    NodeView getNodes() const { return NodeView(m_nodes.data(), m_nodeMask); }
+    const Node* findNode(NodeType type) const {
+        return (m_nodeMask & nodeBit(type)) ? &m_nodes[static_cast<size_t>(type)] : nullptr;
+    }
+    const UnitStore& getUnits() const { return m_units; }
+    UnitStore& getUnits() { return m_units; } // For batch passes over every unit
+    size_t getInfantryCount() const { return m_units.size() - FIRST_INFANTRY_INDEX; }
+
     // Node management
     void initializeNodes(const Position& corePos, const Position& commsPos, const Position& rdPos);
     void addNode(const std::string& typeStr, const Position& pos, int hp, int maxHp, bool defended);
+    void addNode(const Node& node);
     void damageNode(NodeType type, int amount);
     void healNode(NodeType type, int amount);
     void defendNode(NodeType type);
-    
-    // Unit management
-    void addInfantryGroup(const Position& pos, int count, const std::string& id = "");
-    void updateInfantryStats(const std::string& id, int hp, int maxHp);
-    void setLongRangeUnit(const Position& pos, int count, const std::string& id = "");
-    void updateLongRangeStats(int hp, int maxHp);
-    
+
+    // Unit management. Infantry groups are addressed by generational
+    // handles; a known handle (from loaded state) is kept when its slot is
+    // free. Adding returns INVALID_UNIT_HANDLE once MAX_INFANTRY_GROUPS is
+    // reached.
+    UnitHandle addInfantryGroup(const Position& pos, int count, UnitHandle handle = INVALID_UNIT_HANDLE);
+    bool removeInfantryGroup(UnitHandle handle);
+    UnitHandle splitInfantryGroup(UnitHandle handle, int count); // The original keeps its handle
+    void setLongRangeUnit(const Position& pos, int count);
+    void updateUnitStats(UnitHandle handle, int hp, int maxHp);
+
     // Resource management
     void addIntelPoints(int amount);
     void spendIntelPoints(int amount);
-    void setIntelPoints(int amount) { m_intelPoints = amount; }
-    
-    // Status checks
-    bool isCoreAlive() const;
-    bool isCommsAlive() const;
-    bool isRDLabAlive() const;
-    
+    void setIntelPoints(int amount) { m_intelPoints = amount; m_dirty = true; }
+
+    // Status checks. The alive mask has a nodeBit set for every node the
+    // player has with HP left; it is kept up to date as nodes change.
+    uint32_t getAliveNodeMask() const { return m_aliveMask; }
+    bool isCoreAlive() const { return (m_aliveMask & nodeBit(NodeType::CORE)) != 0; }
+    bool isCommsAlive() const { return (m_aliveMask & nodeBit(NodeType::COMMS)) != 0; }
+    bool isRDLabAlive() const { return (m_aliveMask & nodeBit(NodeType::RD)) != 0; }
+
+    // Change tracking. The player itself is dirty when its own fields
+    // (intel points) change; hasPendingChanges also covers its nodes and units.
+    bool isDirty() const { return m_dirty; }
+    uint32_t getVersion() const { return m_version; }
+    bool hasPendingChanges() const;
+    void commitChanges(uint32_t version);
+    void markAllDirty();
+
 private:
     int m_id;
-    std::string m_name;
     int m_intelPoints;
-    std::map<NodeType, Node> m_nodes;
-    std::vector<InfantryGroup> m_infantryGroups;
-    LongRangeUnit m_longRangeUnit;
-    
-    // Generate a new unique ID for units
-    std::string generateUnitId(const std::string& prefix) const;
+    NodeArray m_nodes;          // Indexed by NodeType
+    uint32_t m_nodeMask;        // Types present in m_nodes
+    uint32_t m_aliveMask;
+    UnitStore m_units;
+    bool m_dirty;
+    uint32_t m_version;
+
+    void updateAlive(NodeType type);
 };
+
+// Unit handles cross the JSON/JS boundary as "p<player>-<inf|lr>-<handle>";
+// parseUnitId returns INVALID_UNIT_HANDLE for text that is not in that form
+std::string formatUnitId(int playerId, bool longRange, UnitHandle handle);
+UnitHandle parseUnitId(const std::string& text);
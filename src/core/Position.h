@@ -7,14 +7,14 @@ struct Position {
     int x;
     int y;
     
-    Position() : x(0), y(0) {}
-    Position(int _x, int _y) : x(_x), y(_y) {}
+    constexpr Position() : x(0), y(0) {}
+    constexpr Position(int _x, int _y) : x(_x), y(_y) {}
     
-    bool operator==(const Position& other) const {
+    constexpr bool operator==(const Position& other) const {
         return x == other.x && y == other.y;
     }
     
-    bool operator!=(const Position& other) const {
+    constexpr bool operator!=(const Position& other) const {
         return !(*this == other);
     }
     
@@ -0,0 +1,98 @@
+#include "Snapshot.h"
+#include <cstring>
+
+// Snapshot integers are copied in host byte order, which must be little-endian
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Binary snapshots require a little-endian target"
+#endif
+
+SnapshotWriter::SnapshotWriter(std::vector<uint8_t>& buffer)
+    : m_buffer(buffer)
+{
+}
+
+void SnapshotWriter::writeHeader() {
+    uint16_t version = SNAPSHOT_VERSION;
+    uint16_t reserved = 0;
+    uint32_t totalSize = 0;
+
+    writeBytes(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    writeBytes(&version, sizeof(version));
+    writeBytes(&reserved, sizeof(reserved));
+    writeBytes(&totalSize, sizeof(totalSize));
+}
+
+void SnapshotWriter::writeInt(int32_t value) {
+    writeBytes(&value, sizeof(value));
+}
+
+void SnapshotWriter::writeString(const std::string& text) {
+    uint32_t length = static_cast<uint32_t>(text.size());
+    writeBytes(&length, sizeof(length));
+    writeBytes(text.data(), text.size());
+}
+
+void SnapshotWriter::finish() {
+    uint32_t totalSize = static_cast<uint32_t>(m_buffer.size());
+    std::memcpy(m_buffer.data() + 8, &totalSize, sizeof(totalSize));
+}
+
+void SnapshotWriter::writeBytes(const void* data, std::size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + length);
+}
+
+SnapshotReader::SnapshotReader(const uint8_t* data, std::size_t size)
+    : m_data(data)
+    , m_size(size)
+    , m_offset(0)
+{
+}
+
+bool SnapshotReader::readHeader() {
+    char magic[4];
+    uint16_t version = 0;
+    uint16_t reserved = 0;
+    uint32_t totalSize = 0;
+
+    if (!readBytes(magic, sizeof(magic)) ||
+        !readBytes(&version, sizeof(version)) ||
+        !readBytes(&reserved, sizeof(reserved)) ||
+        !readBytes(&totalSize, sizeof(totalSize))) {
+        return false;
+    }
+
+    return std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0 &&
+           version == SNAPSHOT_VERSION &&
+           totalSize == m_size;
+}
+
+bool SnapshotReader::readInt(int32_t& value) {
+    return readBytes(&value, sizeof(value));
+}
+
+bool SnapshotReader::readString(std::string& text) {
+    uint32_t length = 0;
+    if (!readBytes(&length, sizeof(length)) || length > m_size - m_offset) {
+        return false;
+    }
+    text.assign(reinterpret_cast<const char*>(m_data + m_offset), length);
+    m_offset += length;
+    return true;
+}
+
+bool SnapshotReader::readCount(int32_t& count, std::size_t minRecordSize) {
+    if (!readInt(count) || count < 0) {
+        return false;
+    }
+    return static_cast<std::size_t>(count) * minRecordSize <= m_size - m_offset;
+}
+
+bool SnapshotReader::readBytes(void* out, std::size_t length) {
+    if (length > m_size - m_offset) {
+        return false;
+    }
+    std::memcpy(out, m_data + m_offset, length);
+    m_offset += length;
+    return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Binary snapshot layout (all integers little-endian):
+//
+//   header   magic "NBDS", uint16 version, uint16 reserved, uint32 total size
+//   game     int32 currentTurn, phase, winner, playerCount
+//   player   int32 id, intelPoints, string name
+//            int32 nodeCount,     per node:     int32 type, x, y, hp, maxHp, defended
+//            int32 infantryCount, per group:    int32 handle, x, y, count, hp, maxHp
+//            long range unit:                   int32 handle, x, y, count, hp, maxHp
+//   actions  int32 count,         per action:   int32 playerId, type (ActionType), x, y, unit handle
+//   log      int32 firstSequence, count, per event: int32 code (EventCode), turn, actor, target, detail, amount
+//
+// Strings are stored as a uint32 byte length followed by the raw bytes.
+
+const char SNAPSHOT_MAGIC[4] = { 'N', 'B', 'D', 'S' };
+const uint16_t SNAPSHOT_VERSION = 7;
+const std::size_t SNAPSHOT_HEADER_SIZE = 12;
+
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::vector<uint8_t>& buffer);
+
+    void writeHeader();
+    void writeInt(int32_t value);
+    void writeString(const std::string& text);
+
+    // Patch the total size into the header once everything is written
+    void finish();
+
+private:
+    std::vector<uint8_t>& m_buffer;
+
+    void writeBytes(const void* data, std::size_t length);
+};
+
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, std::size_t size);
+
+    // Validates magic, version and size; must be called first
+    bool readHeader();
+    bool readInt(int32_t& value);
+    bool readString(std::string& text);
+
+    // Reads a count and checks that at least minRecordSize bytes per record remain
+    bool readCount(int32_t& count, std::size_t minRecordSize);
+    bool atEnd() const { return m_offset == m_size; }
+
+private:
+    const uint8_t* m_data;
+    std::size_t m_size;
+    std::size_t m_offset;
+
+    bool readBytes(void* out, std::size_t length);
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CoreState.h"
+
+// Serialized forms of the game state, each kept with the state version it
+// was built at. GameState bumps its version on every mutation path, so an
+// entry whose version matches the current one is still exact and is handed
+// out again without re-encoding.
+class StateCache {
+public:
+    enum Format {
+        FORMAT_JSON = 0,
+        FORMAT_COMPACT_JSON = 1,
+        FORMAT_PLAYER_JSON = 2, // One entry per player from here
+        FORMAT_COUNT = FORMAT_PLAYER_JSON + MAX_PLAYERS
+    };
+
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+    };
+
+    // The cached text of a format, built first with build(std::string&)
+    // when it predates version
+    template <typename Build>
+    const std::string& getText(int format, uint32_t version, Build build) {
+        TextEntry& entry = m_text[format];
+        if (isStale(entry.version, version)) {
+            build(entry.data);
+        }
+        return entry.data;
+    }
+
+    // Same for the binary snapshot, built with build(std::vector<uint8_t>&)
+    template <typename Build>
+    const std::vector<uint8_t>& getSnapshot(uint32_t version, Build build) {
+        if (isStale(m_snapshot.version, version)) {
+            build(m_snapshot.data);
+        }
+        return m_snapshot.data;
+    }
+
+    const Stats& getStats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+private:
+    static const uint32_t NO_VERSION = UINT32_MAX;
+
+    struct TextEntry {
+        std::string data;
+        uint32_t version = NO_VERSION;
+    };
+
+    struct SnapshotEntry {
+        std::vector<uint8_t> data;
+        uint32_t version = NO_VERSION;
+    };
+
+    std::array<TextEntry, FORMAT_COUNT> m_text;
+    SnapshotEntry m_snapshot;
+    Stats m_stats;
+
+    // Counts the lookup and claims the entry for version when it is stale
+    bool isStale(uint32_t& cached, uint32_t version) {
+        if (cached == version) {
+            m_stats.hits++;
+            return false;
+        }
+        m_stats.misses++;
+        cached = version;
+        return true;
+    }
+};
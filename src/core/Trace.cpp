@@ -0,0 +1,97 @@
+#include "Trace.h"
+#include <array>
+#include "JsonWriter.h"
+#include "Metrics.h"
+
+#ifdef NBD_ENABLE_TRACING
+
+namespace {
+
+struct Span {
+    const char* name;
+    uint64_t start; // Nanoseconds
+    uint64_t end;
+};
+
+// Preallocated per thread; recorded counts every span ever recorded, so
+// the retained ones are the last min(recorded, CAPACITY)
+struct SpanRing {
+    std::array<Span, Trace::CAPACITY> spans;
+    uint64_t recorded = 0;
+};
+
+thread_local SpanRing g_ring;
+
+} // namespace
+
+void Trace::record(const char* name, uint64_t start, uint64_t end) {
+    g_ring.spans[g_ring.recorded % CAPACITY] = { name, start, end };
+    g_ring.recorded++;
+}
+
+void Trace::clear() {
+    g_ring.recorded = 0;
+}
+
+size_t Trace::size() {
+    return g_ring.recorded < CAPACITY ? static_cast<size_t>(g_ring.recorded) : CAPACITY;
+}
+
+void Trace::writeJson(std::string& out) {
+    out.clear();
+    JsonWriter json(out, true);
+    json.beginObject();
+    json.key("traceEvents");
+    json.beginArray();
+    for (uint64_t i = g_ring.recorded - size(); i < g_ring.recorded; ++i) {
+        const Span& span = g_ring.spans[i % CAPACITY];
+        json.beginObject();
+        json.field("name", span.name);
+        json.field("ph", "X");
+        json.field("ts", static_cast<double>(span.start) / 1000.0);
+        json.field("dur", static_cast<double>(span.end - span.start) / 1000.0);
+        json.field("pid", 1);
+        json.field("tid", 1);
+        json.endObject();
+    }
+    json.endArray();
+    json.field("displayTimeUnit", "ns");
+    json.endObject();
+}
+
+TraceScope::TraceScope(const char* name)
+    : m_name(name)
+    , m_start(Metrics::now())
+{
+}
+
+TraceScope::~TraceScope() {
+    Trace::record(m_name, m_start, Metrics::now());
+}
+
+#else
+
+void Trace::record(const char* /*name*/, uint64_t /*start*/, uint64_t /*end*/) {
+}
+
+void Trace::clear() {
+}
+
+size_t Trace::size() {
+    return 0;
+}
+
+void Trace::writeJson(std::string& out) {
+    out = "{\"traceEvents\":[]}";
+}
+
+TraceScope::TraceScope(const char* name)
+    : m_name(name)
+    , m_start(0)
+{
+}
+
+TraceScope::~TraceScope() {
+}
+
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Timeline of scoped spans for looking at individual slow turns. Spans are
+// recorded into a fixed ring buffer (the most recent CAPACITY spans are
+// kept) and exported as Chrome trace-event JSON, which chrome://tracing and
+// Perfetto load directly.
+//
+// Everything is compiled out unless NBD_ENABLE_TRACING is defined
+// (`make TRACE=1`): NBD_TRACE_SCOPE expands to nothing and the trace stays
+// empty. The buffer is per thread; a dump covers the calling thread.
+class Trace {
+public:
+    static const size_t CAPACITY = 4096;
+
+    static constexpr bool isEnabled() {
+#ifdef NBD_ENABLE_TRACING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // name must outlive the trace (a string literal)
+    static void record(const char* name, uint64_t start, uint64_t end);
+    static void clear();
+    static size_t size();
+
+    // {"traceEvents":[...]} with one complete ("X") event per span, oldest
+    // first; timestamps are microseconds on the steady clock
+    static void writeJson(std::string& out);
+};
+
+// Records a span from construction to destruction
+class TraceScope {
+public:
+    explicit TraceScope(const char* name);
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name;
+    uint64_t m_start;
+};
+
+#ifdef NBD_ENABLE_TRACING
+#define NBD_TRACE_CONCAT_(a, b) a##b
+#define NBD_TRACE_CONCAT(a, b) NBD_TRACE_CONCAT_(a, b)
+#define NBD_TRACE_SCOPE(name) TraceScope NBD_TRACE_CONCAT(nbdTraceScope, __LINE__)(name)
+#else
+#define NBD_TRACE_SCOPE(name) do {} while (0)
+#endif
@@ -0,0 +1,75 @@
+#include "TurnArena.h"
+
+namespace {
+
+// Heap chunks for turns that outgrow the block, counted
+class HeapFallback : public std::pmr::memory_resource {
+public:
+    explicit HeapFallback(TurnArena::Stats& stats) : m_stats(stats) {}
+
+private:
+    TurnArena::Stats& m_stats;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        m_stats.heapAllocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Monotonic buffer over the block, counting what it hands out
+class Arena : public std::pmr::memory_resource {
+public:
+    Arena() : m_fallback(m_stats), m_buffer(m_block, sizeof(m_block), &m_fallback) {}
+
+    TurnArena::Stats& getStats() { return m_stats; }
+
+    void reset() {
+        m_buffer.release();
+        m_stats.resets++;
+        m_stats.bytes = 0;
+    }
+
+private:
+    alignas(std::max_align_t) unsigned char m_block[TurnArena::BLOCK_SIZE];
+    TurnArena::Stats m_stats;
+    HeapFallback m_fallback;
+    std::pmr::monotonic_buffer_resource m_buffer;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        m_stats.bytes += bytes;
+        m_stats.peakBytes = m_stats.bytes > m_stats.peakBytes ? m_stats.bytes : m_stats.peakBytes;
+        return m_buffer.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*alignment*/) override {
+        // Monotonic: memory comes back all at once on reset
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+thread_local Arena g_arena;
+
+} // namespace
+
+std::pmr::memory_resource* TurnArena::resource() {
+    return &g_arena;
+}
+
+void TurnArena::reset() {
+    g_arena.reset();
+}
+
+const TurnArena::Stats& TurnArena::getStats() {
+    return g_arena.getStats();
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+// Monotonic memory for objects that only live while one turn resolves (the
+// combat kernel's columns). Allocation bumps through a preallocated block
+// per thread and reset() rewinds it at the turn boundary, so steady-state
+// turns never reach the general heap. A turn that outgrows the block takes
+// extra chunks from the heap; those are counted and freed on the next reset.
+//
+// Nothing allocated from resource() may outlive the next reset(), and turns
+// on one thread must not nest; GameState::processActions holds to both.
+class TurnArena {
+public:
+    static const size_t BLOCK_SIZE = 32 * 1024;
+
+    struct Stats {
+        uint64_t resets = 0;
+        uint64_t bytes = 0;          // Handed out since the last reset
+        uint64_t peakBytes = 0;      // Most handed out in any one turn
+        uint64_t heapAllocations = 0; // Chunks taken from the heap, ever
+    };
+
+    // This thread's arena
+    static std::pmr::memory_resource* resource();
+    static void reset();
+    static const Stats& getStats();
+};
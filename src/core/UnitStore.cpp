@@ -0,0 +1,214 @@
+#include "UnitStore.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+int countFromHp(int hp) {
+    return (hp + UNIT_HP - 1) / UNIT_HP;
+}
+
+} // namespace
+
+AttackReach getAttackReach(UnitKind kind) {
+    // Long range reaches 3 squares (Manhattan); infantry only adjacent
+    // squares, diagonals included
+    return kind == UnitKind::LONG_RANGE ? AttackReach{ 3, 3 } : AttackReach{ 2, 1 };
+}
+
+int calculateAttackDamage(UnitKind kind, int count, TargetType targetType) {
+    if (kind == UnitKind::LONG_RANGE) {
+        // Scales with group size against infantry, flat against structures
+        switch (targetType) {
+            case TargetType::INFANTRY:
+                return count * 2;
+            case TargetType::CORE:
+                return count >= 2 ? 35 : 1;
+            default:
+                return count >= 2 ? 5 : 1;
+        }
+    }
+
+    switch (targetType) {
+        case TargetType::INFANTRY:
+            return std::min(15, count / 3);
+        case TargetType::CORE:
+            return std::min(20, count / 2);
+        default:
+            return std::min(10, count / 4);
+    }
+}
+
+UnitStore::UnitStore()
+    : m_x()
+    , m_y()
+    , m_count()
+    , m_hp()
+    , m_maxHp()
+    , m_kind()
+    , m_dirty()
+    , m_version()
+{
+}
+
+UnitHandle UnitStore::add(UnitKind kind, const Position& position, int count, UnitHandle handle) {
+    // A loaded handle whose slot is already taken (older saves) gets a fresh one
+    if (handle == INVALID_UNIT_HANDLE || !m_handles.insertAt(handle)) {
+        handle = m_handles.insert();
+        if (handle == INVALID_UNIT_HANDLE) {
+            return INVALID_UNIT_HANDLE;
+        }
+    }
+
+    size_t index = m_handles.size() - 1;
+    m_x[index] = position.x;
+    m_y[index] = position.y;
+    m_count[index] = count;
+    m_hp[index] = count * UNIT_HP;
+    m_maxHp[index] = count * UNIT_HP;
+    m_kind[index] = static_cast<uint8_t>(kind);
+    m_dirty[index] = 1;
+    m_version[index] = 0;
+    return handle;
+}
+
+bool UnitStore::remove(UnitHandle handle) {
+    int index = m_handles.remove(handle);
+    if (index < 0) {
+        return false;
+    }
+
+    // Mirror the table: the last unit moves into the hole and is republished
+    // at its new index
+    size_t last = m_handles.size();
+    if (static_cast<size_t>(index) != last) {
+        m_x[index] = m_x[last];
+        m_y[index] = m_y[last];
+        m_count[index] = m_count[last];
+        m_hp[index] = m_hp[last];
+        m_maxHp[index] = m_maxHp[last];
+        m_kind[index] = m_kind[last];
+        m_version[index] = m_version[last];
+        m_dirty[index] = 1;
+    }
+    return true;
+}
+
+void UnitStore::setPosition(size_t index, const Position& position) {
+    m_x[index] = position.x;
+    m_y[index] = position.y;
+    m_dirty[index] = 1;
+}
+
+void UnitStore::setCount(size_t index, int count) {
+    m_count[index] = count;
+    m_dirty[index] = 1;
+}
+
+void UnitStore::setHp(size_t index, int hp) {
+    m_hp[index] = std::max(0, std::min(hp, m_maxHp[index]));
+    m_dirty[index] = 1;
+}
+
+void UnitStore::setMaxHp(size_t index, int maxHp) {
+    m_maxHp[index] = maxHp;
+    m_dirty[index] = 1;
+}
+
+void UnitStore::damage(size_t index, int amount) {
+    if (amount <= 0) {
+        return;
+    }
+    m_hp[index] = std::max(0, m_hp[index] - amount);
+    m_count[index] = countFromHp(m_hp[index]);
+    m_dirty[index] = 1;
+}
+
+void UnitStore::heal(size_t index, int amount) {
+    if (amount <= 0) {
+        return;
+    }
+    m_hp[index] = std::min(m_maxHp[index], m_hp[index] + amount);
+    m_count[index] = countFromHp(m_hp[index]);
+    m_dirty[index] = 1;
+}
+
+UnitHandle UnitStore::split(size_t index, int count) {
+    // At least one unit stays behind
+    count = std::min(count, m_count[index] - 1);
+    if (count <= 0 || full()) {
+        return INVALID_UNIT_HANDLE;
+    }
+
+    int splitHp = count * UNIT_HP;
+    m_count[index] -= count;
+    m_hp[index] -= splitHp;
+    m_maxHp[index] = m_count[index] * UNIT_HP;
+    m_dirty[index] = 1;
+
+    return add(getKind(index), getPosition(index), count);
+}
+
+int UnitStore::calculateAttackDamage(size_t index, TargetType targetType) const {
+    return ::calculateAttackDamage(getKind(index), m_count[index], targetType);
+}
+
+bool UnitStore::canAttack(size_t index, const Position& targetPosition) const {
+    int dx = std::abs(m_x[index] - targetPosition.x);
+    int dy = std::abs(m_y[index] - targetPosition.y);
+    AttackReach reach = getAttackReach(getKind(index));
+    return dx + dy <= reach.manhattan && std::max(dx, dy) <= reach.chebyshev && !(dx == 0 && dy == 0);
+}
+
+int UnitStore::damageArea(const Position& center, int radius, int amount) {
+    if (amount <= 0) {
+        return 0;
+    }
+
+    // Branch-free over the packed columns so the loop vectorizes
+    int hits = 0;
+    size_t count = size();
+    for (size_t i = 0; i < count; ++i) {
+        int dx = m_x[i] - center.x;
+        int dy = m_y[i] - center.y;
+        int distance = (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy);
+        int hit = distance <= radius;
+        int hp = m_hp[i] - amount * hit;
+        hp = hp < 0 ? 0 : hp;
+        m_hp[i] = hp;
+        m_count[i] = countFromHp(hp);
+        m_dirty[i] |= static_cast<uint8_t>(hit);
+        hits += hit;
+    }
+    return hits;
+}
+
+void UnitStore::recomputeCounts() {
+    size_t count = size();
+    for (size_t i = 0; i < count; ++i) {
+        int updated = countFromHp(m_hp[i]);
+        m_dirty[i] |= static_cast<uint8_t>(updated != m_count[i]);
+        m_count[i] = updated;
+    }
+}
+
+bool UnitStore::hasPendingChanges() const {
+    uint8_t dirty = 0;
+    for (size_t i = 0; i < size(); ++i) {
+        dirty |= m_dirty[i];
+    }
+    return dirty != 0;
+}
+
+void UnitStore::commitChanges(uint32_t version) {
+    for (size_t i = 0; i < size(); ++i) {
+        m_version[i] = m_dirty[i] ? version : m_version[i];
+        m_dirty[i] = 0;
+    }
+}
+
+void UnitStore::markAllDirty() {
+    for (size_t i = 0; i < size(); ++i) {
+        m_dirty[i] = 1;
+    }
+}
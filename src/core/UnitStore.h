@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Action.h"
+#include "HandleTable.h"
+#include "Position.h"
+
+enum class UnitKind : uint8_t {
+    INFANTRY,
+    LONG_RANGE
+};
+
+const std::size_t MAX_INFANTRY_GROUPS = 16;
+const std::size_t MAX_UNITS = MAX_INFANTRY_GROUPS + 1; // Plus the long range unit
+
+// Every HP point is worth half a unit: count is HP / 2, rounded up
+const int UNIT_HP = 2;
+
+// Attack rules by unit kind, shared by UnitStore and CombatKernel. A unit
+// reaches the cells within `manhattan` steps that are also within
+// `chebyshev` steps along each axis, except its own cell.
+struct AttackReach {
+    int manhattan;
+    int chebyshev;
+};
+AttackReach getAttackReach(UnitKind kind);
+int calculateAttackDamage(UnitKind kind, int count, TargetType targetType);
+
+// A player's units, stored as parallel arrays (struct of arrays) so per-turn
+// passes over all units stream through tightly packed ints and vectorize.
+// Units are addressed by dense index for iteration and by generational
+// handle (see HandleTable) for stable references; removal moves the last
+// unit into the hole. Each unit carries its own dirty flag and version, like
+// Node. Pointer-free and trivially copyable.
+class UnitStore {
+public:
+    UnitStore();
+
+    size_t size() const { return m_handles.size(); }
+    bool full() const { return m_handles.full(); }
+
+    // Per-unit access by dense index
+    UnitHandle getHandle(size_t index) const { return m_handles.handleAt(index); }
+    int indexOf(UnitHandle handle) const { return m_handles.indexOf(handle); }
+    UnitKind getKind(size_t index) const { return static_cast<UnitKind>(m_kind[index]); }
+    Position getPosition(size_t index) const { return Position(m_x[index], m_y[index]); }
+    int getCount(size_t index) const { return m_count[index]; }
+    int getHp(size_t index) const { return m_hp[index]; }
+    int getMaxHp(size_t index) const { return m_maxHp[index]; }
+
+    // Packed columns, size() entries each
+    const int32_t* getCounts() const { return m_count; }
+    const int32_t* getHps() const { return m_hp; }
+
+    // Adds a unit with full HP. A known handle (from loaded state) is kept
+    // when its slot is free; returns INVALID_UNIT_HANDLE when full.
+    UnitHandle add(UnitKind kind, const Position& position, int count, UnitHandle handle = INVALID_UNIT_HANDLE);
+    bool remove(UnitHandle handle);
+
+    void setPosition(size_t index, const Position& position);
+    void setCount(size_t index, int count);
+    void setHp(size_t index, int hp); // Clamped to [0, maxHp]
+    void setMaxHp(size_t index, int maxHp);
+
+    // Unit rules. damage and heal keep the count in step with HP; split
+    // moves `count` units (keeping at least one behind) into a new unit at
+    // the same position and returns its handle.
+    void damage(size_t index, int amount);
+    void heal(size_t index, int amount);
+    UnitHandle split(size_t index, int count);
+    int calculateAttackDamage(size_t index, TargetType targetType) const;
+    bool canAttack(size_t index, const Position& targetPosition) const;
+
+    // Batch passes over every unit. damageArea hits units within Manhattan
+    // distance `radius` of center and returns how many it hit.
+    int damageArea(const Position& center, int radius, int amount);
+    void recomputeCounts();
+
+    // Change tracking (see Node)
+    bool isDirty(size_t index) const { return m_dirty[index] != 0; }
+    uint32_t getVersion(size_t index) const { return m_version[index]; }
+    void markDirty(size_t index) { m_dirty[index] = 1; }
+    bool hasPendingChanges() const;
+    void commitChanges(uint32_t version);
+    void markAllDirty();
+
+private:
+    HandleTable<MAX_UNITS> m_handles;
+    int32_t m_x[MAX_UNITS];
+    int32_t m_y[MAX_UNITS];
+    int32_t m_count[MAX_UNITS];
+    int32_t m_hp[MAX_UNITS];
+    int32_t m_maxHp[MAX_UNITS];
+    uint8_t m_kind[MAX_UNITS];
+    uint8_t m_dirty[MAX_UNITS];
+    uint32_t m_version[MAX_UNITS];
+};
@@ -0,0 +1,104 @@
+#include "Visibility.h"
+
+namespace {
+
+// Vision masks include the cell the source stands on
+constexpr CellMasks buildVisionMasks(int range) {
+    CellMasks masks = buildCellMasks(range, true);
+    for (int cell = 0; cell < BOARD_CELL_COUNT; ++cell) {
+        masks[cell].set(cell);
+    }
+    return masks;
+}
+
+constexpr CellMasks UNIT_VISION_MASKS = buildVisionMasks(Visibility::UNIT_VISION_RANGE);
+constexpr CellMasks NODE_VISION_MASKS = buildVisionMasks(Visibility::NODE_VISION_RANGE);
+constexpr CellMasks SPY_MASKS = buildVisionMasks(Visibility::SPY_RANGE);
+
+} // namespace
+
+Visibility::Visibility() {
+    for (auto& vision : m_players) {
+        vision.sourceCells.fill(NO_CELL);
+        vision.viewers.fill(0);
+        vision.sight = Bitboard();
+        vision.revealed = Bitboard();
+        vision.visible = Bitboard();
+    }
+}
+
+void Visibility::update(const std::array<Player, MAX_PLAYERS>& players, uint32_t stateVersion) {
+    for (size_t p = 0; p < players.size(); ++p) {
+        const Player& player = players[p];
+        PlayerVision& vision = m_players[p];
+
+        for (size_t type = 0; type < NODE_TYPE_COUNT; ++type) {
+            const Node* node = player.findNode(static_cast<NodeType>(type));
+            if (!node) {
+                moveSource(vision, type, NO_CELL, NODE_VISION_MASKS);
+            } else if (node->getVersion() == stateVersion) {
+                bool alive = (player.getAliveNodeMask() & nodeBit(node->getType())) != 0;
+                moveSource(vision, type, alive ? cellIndex(node->getPosition()) : NO_CELL, NODE_VISION_MASKS);
+            }
+        }
+
+        // Removing a unit moves the last one into its index (republishing
+        // it), so only stamped indices and the vacated tail can change
+        const UnitStore& units = player.getUnits();
+        for (size_t i = 0; i < MAX_UNITS; ++i) {
+            size_t source = NODE_TYPE_COUNT + i;
+            if (i >= units.size()) {
+                moveSource(vision, source, NO_CELL, UNIT_VISION_MASKS);
+            } else if (units.getVersion(i) == stateVersion) {
+                int cell = units.getCount(i) > 0 ? cellIndex(units.getPosition(i)) : NO_CELL;
+                moveSource(vision, source, cell, UNIT_VISION_MASKS);
+            }
+        }
+
+        vision.visible = vision.sight | vision.revealed;
+    }
+}
+
+void Visibility::reveal(int playerId, const Position& center) {
+    int cell = cellIndex(center);
+    if (cell == NO_CELL) {
+        return;
+    }
+    PlayerVision& vision = m_players[playerId];
+    vision.revealed |= SPY_MASKS[cell];
+    vision.visible = vision.sight | vision.revealed;
+}
+
+void Visibility::clearReveals() {
+    for (auto& vision : m_players) {
+        vision.revealed = Bitboard();
+        vision.visible = vision.sight;
+    }
+}
+
+bool Visibility::isVisible(int playerId, const Position& pos) const {
+    int cell = cellIndex(pos);
+    return cell != NO_CELL && m_players[playerId].visible.test(cell);
+}
+
+void Visibility::moveSource(PlayerVision& vision, size_t source, int cell, const CellMasks& masks) {
+    int previous = vision.sourceCells[source];
+    if (previous == cell) {
+        return;
+    }
+    if (previous != NO_CELL) {
+        masks[previous].forEach([&](int seen) {
+            if (--vision.viewers[seen] == 0) {
+                vision.sight.reset(seen);
+            }
+        });
+    }
+    if (cell != NO_CELL) {
+        masks[cell].forEach([&](int seen) {
+            if (vision.viewers[seen]++ == 0) {
+                vision.sight.set(seen);
+            }
+        });
+    }
+    vision.sourceCells[source] = static_cast<int16_t>(cell);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "Bitboard.h"
+#include "CoreState.h"
+#include "Position.h"
+
+// Fog of war. A player sees every cell within UNIT_VISION_RANGE of its
+// units and NODE_VISION_RANGE of its live nodes (Manhattan), plus the cells
+// its spies revealed this turn. Each player keeps a per-cell count of the
+// sources that see it, so an update only revisits the nodes and units
+// stamped with the new state version (the ones that moved, changed or
+// died) instead of rebuilding the sets.
+class Visibility {
+public:
+    static const int UNIT_VISION_RANGE = 3;
+    static const int NODE_VISION_RANGE = 2;
+    static const int SPY_RANGE = 4;
+
+    Visibility();
+
+    // Call after a commit, like Board::update. Player ids must match their
+    // index in players.
+    void update(const std::array<Player, MAX_PLAYERS>& players, uint32_t stateVersion);
+
+    // Spy reveals last until clearReveals (the next turn's resolution);
+    // centers off the board are ignored
+    void reveal(int playerId, const Position& center);
+    void clearReveals();
+
+    const Bitboard& getVisible(int playerId) const { return m_players[playerId].visible; }
+    bool isVisible(int playerId, const Position& pos) const;
+
+private:
+    // Sources are the nodes (by NodeType) followed by unit store indices
+    static const size_t SOURCE_COUNT = NODE_TYPE_COUNT + MAX_UNITS;
+
+    struct PlayerVision {
+        std::array<int16_t, SOURCE_COUNT> sourceCells; // NO_CELL when not seeing
+        std::array<uint8_t, BOARD_CELL_COUNT> viewers;
+        Bitboard sight;    // Cells with viewers
+        Bitboard revealed;
+        Bitboard visible;  // sight | revealed
+    };
+
+    std::array<PlayerVision, MAX_PLAYERS> m_players;
+
+    static void moveSource(PlayerVision& vision, size_t source, int cell, const CellMasks& masks);
+};
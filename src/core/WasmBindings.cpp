@@ -1,7 +1,10 @@
 #include <emscripten/bind.h>
 #include <emscripten/val.h>
+#include <memory>
 #include "GameState.h"
+#include "MctsSearch.h"
 #include "Position.h"
+#include "Trace.h"
 
 using namespace emscripten;
 
@@ -9,6 +12,15 @@ using namespace emscripten;
 class GameStateWrapper {
 private:
     std::unique_ptr<GameState> m_gameState;
+    mutable std::string m_stateBuffer; // Reused across delta and replay calls
+    mutable std::vector<std::string> m_logBuffer; // Reused across game log calls
+    mutable std::vector<int> m_entityBuffer; // Reused across board queries
+    mutable Metrics::Array m_metrics;
+    std::vector<int32_t> m_turnBuffer; // Reused across submitTurn calls
+    std::vector<int32_t> m_resultBuffer;
+    MctsSearch m_search; // Kept across calls so its scratch buffers are reused
+    std::vector<Action> m_aiActions;
+    GameState m_replay; // Target of journal seeks; kept so its buffers are reused
 
 public:
     GameStateWrapper() : m_gameState(std::make_unique<GameState>()) {}
@@ -17,9 +29,35 @@ public:
         m_gameState->initializeGame(player1Name, player2Name);
     }
     
-    void submitAction(int playerId, const std::string& actionType, int x, int y) {
+    // Action names are parsed once here; the core only sees ActionType.
+    // Returns the SubmitResult code; unknown action names are INVALID_ACTION.
+    int submitAction(int playerId, const std::string& actionName, int x, int y) {
+        ActionType actionType;
+        if (!parseActionType(actionName, actionType)) {
+            return static_cast<int>(SubmitResult::INVALID_ACTION);
+        }
         Position targetPos(x, y);
-        m_gameState->submitAction(playerId, actionType, targetPos);
+        return static_cast<int>(m_gameState->submitAction(playerId, actionType, targetPos));
+    }
+    
+    // Submits a whole turn in one call. actions is an Int32Array of
+    // ACTION_TUPLE_WORDS-int tuples (player, ActionType code, x, y, unit
+    // handle or 0); returns an Int32Array with one SubmitResult code per
+    // tuple, or null when the length is not a whole number of tuples.
+    val submitTurn(const val& actions) {
+        size_t length = actions["length"].as<size_t>();
+        if (length % ACTION_TUPLE_WORDS != 0) {
+            return val::null();
+        }
+        size_t count = length / ACTION_TUPLE_WORDS;
+        m_turnBuffer.resize(length);
+        m_resultBuffer.resize(count);
+        // One bulk copy into Wasm memory
+        val(typed_memory_view(m_turnBuffer.size(), m_turnBuffer.data())).call<void>("set", actions);
+        
+        m_gameState->submitActions(m_turnBuffer.data(), count, m_resultBuffer.data());
+        val view(typed_memory_view(m_resultBuffer.size(), m_resultBuffer.data()));
+        return val::global("Int32Array").new_(view);
     }
     
     void endTurn() {
@@ -42,12 +80,122 @@ public:
         return static_cast<int>(m_gameState->getGamePhase());
     }
     
+    // Re-encoded only when the state version has changed (GameState::getStateJson)
     std::string getGameState() const {
-        return m_gameState->serializeState();
+        return m_gameState->getStateJson();
+    }
+    
+    // The state as one player sees it under fog of war; cached per state version
+    std::string getPlayerState(int playerId) const {
+        if (playerId < 0 || playerId >= MAX_PLAYERS) {
+            return std::string();
+        }
+        return m_gameState->getPlayerState(playerId);
+    }
+    
+    unsigned int getStateVersion() const {
+        return m_gameState->getStateVersion();
+    }
+    
+    // Compact JSON with only the entities and log lines changed after sinceVersion
+    std::string getStateDelta(unsigned int sinceVersion) const {
+        m_gameState->getStateDelta(sinceVersion, m_stateBuffer);
+        return m_stateBuffer;
+    }
+    
+    // Int32Array over the packed board mirror in Wasm memory (no copy).
+    // The view is invalidated when the state changes or memory grows, so
+    // callers should re-acquire it rather than keep it across frames.
+    val getBoardView() const {
+        const BoardView& view = m_gameState->getBoardView();
+        return val(typed_memory_view(view.size(), view.data()));
+    }
+    
+    // Board queries return entity indices into the board view
+    val getEntitiesAt(int x, int y) const {
+        const Board& board = m_gameState->getBoard();
+        val result = val::array();
+        int i = 0;
+        for (int entity = board.getFirstAt(Position(x, y)); entity != Board::NONE; entity = board.getNextAt(entity)) {
+            result.set(i++, entity);
+        }
+        return result;
+    }
+    
+    // kind is BoardView::KIND_INFANTRY (with the group index) or KIND_LONG_RANGE
+    val getEnemiesInRange(int playerId, int kind, int index) const {
+        const Board& board = m_gameState->getBoard();
+        board.findEnemiesInRange(board.findUnit(playerId, static_cast<BoardView::Kind>(kind), index), m_entityBuffer);
+        val result = val::array();
+        for (size_t i = 0; i < m_entityBuffer.size(); ++i) {
+            result.set(i, m_entityBuffer[i]);
+        }
+        return result;
     }
     
-    void loadGameState(const std::string& jsonState) {
-        m_gameState->deserializeState(jsonState);
+    // Actions the AI would submit for playerId this turn, as
+    // [{action, x, y, unit}]; a budget of 0 disables that limit. Empty for an
+    // unknown player.
+    val getAiActions(int playerId, int iterations, double timeLimitMs, int actionsPerTurn) {
+        if (playerId < 0 || playerId >= MAX_PLAYERS) {
+            return val::array();
+        }
+        MctsConfig config = m_search.getConfig();
+        config.iterations = iterations;
+        config.timeLimitMs = timeLimitMs;
+        config.actionsPerTurn = actionsPerTurn > 0 ? actionsPerTurn : 1;
+        m_search.setConfig(config);
+        m_search.search(*m_gameState, playerId, m_aiActions);
+        
+        val result = val::array();
+        for (size_t i = 0; i < m_aiActions.size(); ++i) {
+            val action = val::object();
+            action.set("action", std::string(getActionTypeName(m_aiActions[i].type)));
+            action.set("x", m_aiActions[i].targetPos.x);
+            action.set("y", m_aiActions[i].targetPos.y);
+            action.set("unit", static_cast<double>(m_aiActions[i].unit));
+            result.set(i, action);
+        }
+        return result;
+    }
+    
+    bool loadGameState(const std::string& jsonState) {
+        return m_gameState->deserializeState(jsonState);
+    }
+    
+    // Returns a Uint8Array copy of the binary snapshot
+    val saveSnapshot() const {
+        const std::vector<uint8_t>& snapshot = m_gameState->getSnapshot();
+        val view(typed_memory_view(snapshot.size(), snapshot.data()));
+        return val::global("Uint8Array").new_(view);
+    }
+    
+    // Float64Array copy of the runtime counters (layout in Metrics.h)
+    val getMetrics() const {
+        m_gameState->getMetrics(m_metrics);
+        val view(typed_memory_view(m_metrics.size(), m_metrics.data()));
+        return val::global("Float64Array").new_(view);
+    }
+    
+    void resetMetrics() {
+        m_gameState->resetMetrics();
+    }
+    
+    // Serialization cache counters since the last reset: { hits, misses }
+    val getCacheStats() const {
+        val result = val::object();
+        result.set("hits", m_gameState->getStateCacheStats().hits);
+        result.set("misses", m_gameState->getStateCacheStats().misses);
+        return result;
+    }
+    
+    void resetCacheStats() {
+        m_gameState->resetStateCacheStats();
+    }
+    
+    bool loadSnapshot(const val& bytes) {
+        std::vector<uint8_t> data = convertJSArrayToNumberVector<uint8_t>(bytes);
+        return m_gameState->loadSnapshot(data.data(), data.size());
     }
     
     val getPlayerInfo(int playerId) const {
@@ -55,13 +203,12 @@ public:
         val result = val::object();
         
         result.set("id", player.getId());
-        result.set("name", player.getName());
+        result.set("name", m_gameState->getPlayerName(playerId));
         result.set("intelPoints", player.getIntelPoints());
         
         // Nodes
         val nodesObj = val::object();
-        for (const auto& nodeData : player.getNodes()) {
-            const Node& node = nodeData.second;
+        for (const auto& node : player.getNodes()) {
             val nodeObj = val::object();
             
             nodeObj.set("type", node.getTypeName());
@@ -77,32 +224,30 @@ public:
         
         // Infantry groups
         val infantryArray = val::array();
-        const auto& infantryGroups = player.getInfantryGroups();
-        for (size_t i = 0; i < infantryGroups.size(); ++i) {
-            const auto& infantry = infantryGroups[i];
+        const auto& units = player.getUnits();
+        for (size_t i = FIRST_INFANTRY_INDEX; i < units.size(); ++i) {
             val infObj = val::object();
             
-            infObj.set("id", infantry.getId());
-            infObj.set("posX", infantry.getPosition().x);
-            infObj.set("posY", infantry.getPosition().y);
-            infObj.set("count", infantry.getCount());
-            infObj.set("hp", infantry.getHp());
-            infObj.set("maxHp", infantry.getMaxHp());
+            infObj.set("id", formatUnitId(player.getId(), false, units.getHandle(i)));
+            infObj.set("posX", units.getPosition(i).x);
+            infObj.set("posY", units.getPosition(i).y);
+            infObj.set("count", units.getCount(i));
+            infObj.set("hp", units.getHp(i));
+            infObj.set("maxHp", units.getMaxHp(i));
             
-            infantryArray.set(i, infObj);
+            infantryArray.set(i - FIRST_INFANTRY_INDEX, infObj);
         }
         result.set("infantry", infantryArray);
         
         // Long range unit
-        const auto& lr = player.getLongRangeUnit();
         val lrObj = val::object();
         
-        lrObj.set("id", lr.getId());
-        lrObj.set("posX", lr.getPosition().x);
-        lrObj.set("posY", lr.getPosition().y);
-        lrObj.set("count", lr.getCount());
-        lrObj.set("hp", lr.getHp());
-        lrObj.set("maxHp", lr.getMaxHp());
+        lrObj.set("id", formatUnitId(player.getId(), true, units.getHandle(0)));
+        lrObj.set("posX", units.getPosition(0).x);
+        lrObj.set("posY", units.getPosition(0).y);
+        lrObj.set("count", units.getCount(0));
+        lrObj.set("hp", units.getHp(0));
+        lrObj.set("maxHp", units.getMaxHp(0));
         
         result.set("longRange", lrObj);
         
@@ -110,15 +255,47 @@ public:
     }
     
     val getGameLog() const {
-        const auto& gameLog = m_gameState->getGameLog();
+        const EventLog& log = m_gameState->getEventLog();
+        return getLogRange(log.getFirstSequence(), log.size());
+    }
+    
+    // Log entries are formatted only for the requested range
+    val getLogRange(unsigned int fromSequence, unsigned int count) const {
+        m_gameState->getLogRange(fromSequence, count, m_logBuffer);
         val result = val::array();
         
-        for (size_t i = 0; i < gameLog.size(); ++i) {
-            result.set(i, gameLog[i]);
+        for (size_t i = 0; i < m_logBuffer.size(); ++i) {
+            result.set(i, m_logBuffer[i]);
         }
         
         return result;
     }
+    
+    unsigned int getLogStart() const {
+        return m_gameState->getEventLog().getFirstSequence();
+    }
+    
+    unsigned int getLogEnd() const {
+        return m_gameState->getEventLog().getEndSequence();
+    }
+    
+    // Replay of the match as it stood at the start of a journaled turn;
+    // empty if the turn is outside [getJournalStart(), getJournalEnd()]
+    std::string getReplayState(int turn) {
+        if (!m_gameState->getJournal().seek(turn, m_replay)) {
+            return std::string();
+        }
+        m_replay.serializeState(m_stateBuffer, true);
+        return m_stateBuffer;
+    }
+    
+    int getJournalStart() const {
+        return m_gameState->getJournal().getFirstTurn();
+    }
+    
+    int getJournalEnd() const {
+        return m_gameState->getJournal().getEndTurn();
+    }
 };
 
 // Helper function for Position struct
@@ -136,20 +313,48 @@ Position positionFromJS(const val& obj) {
 }
 
 // Binding code
+// Chrome trace-event JSON of the recorded spans; empty unless the module
+// was built with TRACE=1
+std::string getTraceJson() {
+    std::string out;
+    Trace::writeJson(out);
+    return out;
+}
+
 EMSCRIPTEN_BINDINGS(noise_before_defeat) {
     class_<GameStateWrapper>("GameState")
         .constructor<>()
         .function("initializeGame", &GameStateWrapper::initializeGame)
         .function("submitAction", &GameStateWrapper::submitAction)
+        .function("submitTurn", &GameStateWrapper::submitTurn)
         .function("endTurn", &GameStateWrapper::endTurn)
         .function("isGameOver", &GameStateWrapper::isGameOver)
         .function("getWinner", &GameStateWrapper::getWinner)
         .function("getCurrentTurn", &GameStateWrapper::getCurrentTurn)
         .function("getGamePhase", &GameStateWrapper::getGamePhase)
         .function("getGameState", &GameStateWrapper::getGameState)
+        .function("getPlayerState", &GameStateWrapper::getPlayerState)
+        .function("getStateVersion", &GameStateWrapper::getStateVersion)
+        .function("getStateDelta", &GameStateWrapper::getStateDelta)
+        .function("getBoardView", &GameStateWrapper::getBoardView)
+        .function("getEntitiesAt", &GameStateWrapper::getEntitiesAt)
+        .function("getEnemiesInRange", &GameStateWrapper::getEnemiesInRange)
+        .function("getAiActions", &GameStateWrapper::getAiActions)
         .function("loadGameState", &GameStateWrapper::loadGameState)
+        .function("saveSnapshot", &GameStateWrapper::saveSnapshot)
+        .function("loadSnapshot", &GameStateWrapper::loadSnapshot)
+        .function("getMetrics", &GameStateWrapper::getMetrics)
+        .function("resetMetrics", &GameStateWrapper::resetMetrics)
+        .function("getCacheStats", &GameStateWrapper::getCacheStats)
+        .function("resetCacheStats", &GameStateWrapper::resetCacheStats)
         .function("getPlayerInfo", &GameStateWrapper::getPlayerInfo)
-        .function("getGameLog", &GameStateWrapper::getGameLog);
+        .function("getGameLog", &GameStateWrapper::getGameLog)
+        .function("getLogRange", &GameStateWrapper::getLogRange)
+        .function("getLogStart", &GameStateWrapper::getLogStart)
+        .function("getLogEnd", &GameStateWrapper::getLogEnd)
+        .function("getReplayState", &GameStateWrapper::getReplayState)
+        .function("getJournalStart", &GameStateWrapper::getJournalStart)
+        .function("getJournalEnd", &GameStateWrapper::getJournalEnd);
         
     value_object<Position>("Position")
         .field("x", &Position::x)
@@ -157,6 +362,20 @@ EMSCRIPTEN_BINDINGS(noise_before_defeat) {
         
     register_vector<std::string>("VectorString");
     
+    function("getTraceJson", &getTraceJson);
+    function("clearTrace", &Trace::clear);
+    constant("TRACE_ENABLED", Trace::isEnabled());
+    
+    // Board view layout (see BoardView.h)
+    constant("BOARD_VIEW_HEADER_WORDS", static_cast<int>(BoardView::HEADER_WORDS));
+    constant("BOARD_VIEW_FIELD_COUNT", static_cast<int>(BoardView::FIELD_COUNT));
+    constant("BOARD_VIEW_LAYOUT_VERSION", BoardView::LAYOUT_VERSION);
+    constant("BOARD_RADIUS", Board::RADIUS);
+    
+    // Metrics layout (see Metrics.h)
+    constant("METRICS_LAYOUT_VERSION", Metrics::LAYOUT_VERSION);
+    constant("METRICS_WORD_COUNT", static_cast<int>(Metrics::WORD_COUNT));
+    
     function("positionToJS", &positionToJS);
     function("positionFromJS", &positionFromJS);
 }
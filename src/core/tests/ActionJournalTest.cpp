@@ -0,0 +1,83 @@
+#include "Test.h"
+
+NBD_TEST(journalSeekReproducesRecordedStates) {
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        std::mt19937 rng(seed);
+        std::vector<Action> actions;
+        GameState game;
+        game.initializeGame("Player 1", "Player 2");
+
+        // State at the start of every turn, before any submission
+        std::vector<CoreState> states;
+        while (!game.isGameOver() && game.getCurrentTurn() <= 120) {
+            CoreState start;
+            game.clone(start);
+            states.push_back(start);
+            playRandomTurn(game, rng, 2, actions);
+        }
+        CoreState end;
+        game.clone(end);
+        states.push_back(end);
+
+        const ActionJournal& journal = game.getJournal();
+        CHECK(journal.getFirstTurn() == 1);
+        CHECK(journal.getEndTurn() == journal.getFirstTurn() + static_cast<int>(states.size()) - 1);
+        CHECK(journal.getTurnCount() < ActionJournal::CHECKPOINT_INTERVAL || journal.getCheckpointCount() > 1);
+
+        // Seek backwards too, so every checkpoint is restored more than once
+        GameState replay;
+        replay.initializeGame("Player 1", "Player 2");
+        for (int turn = journal.getEndTurn(); turn >= journal.getFirstTurn(); --turn) {
+            CHECK(journal.seek(turn, replay));
+            CHECK(sameCoreState(replay.getCoreState(), states[turn - journal.getFirstTurn()]));
+        }
+
+        CHECK(!journal.seek(journal.getFirstTurn() - 1, replay));
+        CHECK(!journal.seek(journal.getEndTurn() + 1, replay));
+    }
+}
+
+NBD_TEST(journalRestartsOnLoad) {
+    std::mt19937 rng(3);
+    std::vector<Action> actions;
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    for (int turn = 0; turn < 20; ++turn) {
+        playRandomTurn(game, rng, 1, actions);
+    }
+
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+    GameState loaded;
+    CHECK(loaded.loadSnapshot(saved.data(), saved.size()));
+    CHECK(loaded.getJournal().getFirstTurn() == game.getCurrentTurn());
+    CHECK(loaded.getJournal().getTurnCount() == 0);
+
+    GameState replay;
+    CHECK(loaded.getJournal().seek(game.getCurrentTurn(), replay));
+    CHECK(sameCoreState(replay.getCoreState(), game.getCoreState()));
+}
+
+// Full turns up to RESERVED_TURNS are recorded without the journal growing,
+// so processActions never reallocates it
+NBD_TEST(journalReservesFullTurns) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    const Action* first = nullptr;
+    for (int turn = 0; turn < ActionJournal::RESERVED_TURNS; ++turn) {
+        for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+            for (size_t i = 0; i < MAX_PENDING_ACTIONS_PER_PLAYER; ++i) {
+                game.submitAction(playerId, ActionType::SPY, Position());
+            }
+        }
+        game.endTurn();
+
+        size_t count = 0;
+        const Action* actions = game.getJournal().getTurnActions(1, count);
+        CHECK(count == MAX_PENDING_ACTIONS);
+        first = first ? first : actions;
+        CHECK(actions == first);
+    }
+    CHECK(!game.isGameOver());
+    CHECK(game.getJournal().getTurnCount() == ActionJournal::RESERVED_TURNS);
+}
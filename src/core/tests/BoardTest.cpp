@@ -0,0 +1,149 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+struct EntityRef {
+    int owner;
+    Position position;
+    bool occupies;      // Nodes always; units while they have a count
+};
+
+// Entities in Board order (per player: nodes, then units by store index),
+// rebuilt from the players alone
+std::vector<EntityRef> listEntities(const GameState& game) {
+    std::vector<EntityRef> out;
+    for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+        const Player& player = game.getPlayer(playerId);
+        for (const auto& node : player.getNodes()) {
+            out.push_back({ playerId, node.getPosition(), true });
+        }
+        const UnitStore& units = player.getUnits();
+        for (size_t i = 0; i < units.size(); ++i) {
+            out.push_back({ playerId, units.getPosition(i), units.getCount(i) > 0 });
+        }
+    }
+    return out;
+}
+
+// Board queries for every unit against brute force over UnitStore::canAttack
+// and the Chebyshev-1 neighbourhood
+void checkRangeQueries(const GameState& game) {
+    const Board& board = game.getBoard();
+    std::vector<EntityRef> entities = listEntities(game);
+    CHECK(board.getEntityCount() == static_cast<int>(entities.size()));
+
+    Bitboard occupied;
+    for (int cell = 0; cell < Board::CELL_COUNT; ++cell) {
+        Position pos = cellPosition(cell);
+        bool expected = false;
+        for (const EntityRef& entity : entities) {
+            expected = expected || (entity.occupies && entity.position == pos);
+        }
+        CHECK(board.isOccupied(pos) == expected);
+        if (expected) {
+            occupied.set(cell);
+        }
+    }
+
+    std::vector<int> found;
+    for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+        const UnitStore& units = game.getPlayer(playerId).getUnits();
+        int longRange = board.findUnit(playerId, BoardView::KIND_LONG_RANGE, 0);
+        CHECK(longRange != Board::NONE);
+        Bitboard threats;
+
+        for (size_t i = 0; i < units.size(); ++i) {
+            int entity = longRange + static_cast<int>(i);
+            bool alive = units.getCount(i) > 0;
+            Position from = units.getPosition(i);
+
+            Bitboard reach;
+            Bitboard steps;
+            for (int cell = 0; cell < Board::CELL_COUNT; ++cell) {
+                Position to = cellPosition(cell);
+                if (alive && units.canAttack(i, to)) {
+                    reach.set(cell);
+                }
+                bool adjacent = std::max(std::abs(to.x - from.x), std::abs(to.y - from.y)) == 1;
+                if (alive && adjacent && !occupied.test(cell)) {
+                    steps.set(cell);
+                }
+            }
+            CHECK(board.getAttackMask(entity) == reach);
+            CHECK(board.getMoveTargets(entity) == steps);
+            threats |= reach;
+
+            std::vector<int> expected;
+            for (int other = 0; other < static_cast<int>(entities.size()); ++other) {
+                const EntityRef& target = entities[other];
+                if (target.owner != playerId && target.occupies && alive && units.canAttack(i, target.position)) {
+                    expected.push_back(other);
+                }
+            }
+            board.findEnemiesInRange(entity, found);
+            std::sort(found.begin(), found.end());
+            CHECK(found == expected);
+        }
+        CHECK(board.getThreats(playerId) == threats);
+    }
+}
+
+} // namespace
+
+NBD_TEST(bitboardMasksMatchRangeQueries) {
+    // Unit masks alone, from every cell of the board
+    for (int cell = 0; cell < Board::CELL_COUNT; ++cell) {
+        UnitStore units;
+        units.add(UnitKind::INFANTRY, cellPosition(cell), 1);
+        units.add(UnitKind::LONG_RANGE, cellPosition(cell), 1);
+        for (int target = 0; target < Board::CELL_COUNT; ++target) {
+            CHECK(INFANTRY_ATTACK_MASKS[cell].test(target) == units.canAttack(0, cellPosition(target)));
+            CHECK(LONG_RANGE_ATTACK_MASKS[cell].test(target) == units.canAttack(1, cellPosition(target)));
+        }
+    }
+
+    // The incrementally maintained index over real matches
+    std::mt19937 rng(13);
+    std::vector<Action> actions;
+    for (int match = 0; match < 6; ++match) {
+        GameState game;
+        game.initializeGame("Player 1", "Player 2");
+        checkRangeQueries(game);
+        while (!game.isGameOver() && game.getCurrentTurn() <= 150) {
+            playRandomTurn(game, rng, 3, actions);
+            checkRangeQueries(game);
+        }
+    }
+}
+
+NBD_TEST(boardFollowsUnitEdits) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+
+    // Moves, stacking, splits, deaths and removals between commits
+    Player& player = game.getPlayerMutable(0);
+    UnitHandle group = player.getUnits().getHandle(FIRST_INFANTRY_INDEX);
+    player.setLongRangeUnit(Position(0, 1), 5);
+    game.commitChanges();
+    checkRangeQueries(game);
+
+    player.getUnits().setPosition(FIRST_INFANTRY_INDEX, Position(0, 1));
+    game.commitChanges();
+    checkRangeQueries(game);
+
+    UnitHandle split = player.splitInfantryGroup(group, 10);
+    CHECK(split != INVALID_UNIT_HANDLE);
+    game.commitChanges();
+    checkRangeQueries(game);
+
+    player.getUnits().setCount(FIRST_INFANTRY_INDEX, 0);
+    game.commitChanges();
+    checkRangeQueries(game);
+
+    CHECK(player.removeInfantryGroup(split));
+    game.commitChanges();
+    checkRangeQueries(game);
+}
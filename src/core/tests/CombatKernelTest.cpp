@@ -0,0 +1,123 @@
+#include "Test.h"
+
+#include <cstdlib>
+#include "CombatKernel.h"
+
+namespace {
+
+struct Attacker {
+    int owner;
+    UnitKind kind;
+    Position position;
+    int count;
+};
+
+struct Target {
+    int owner;
+    TargetType type;
+    Position position;
+};
+
+// Naive per-pair damage: every enemy attacker in reach adds its own damage
+int referenceDamage(const std::vector<Attacker>& attackers, const Target& target) {
+    int damage = 0;
+    for (const Attacker& attacker : attackers) {
+        int dx = std::abs(attacker.position.x - target.position.x);
+        int dy = std::abs(attacker.position.y - target.position.y);
+        AttackReach reach = getAttackReach(attacker.kind);
+        bool inReach = dx + dy <= reach.manhattan && std::max(dx, dy) <= reach.chebyshev && dx + dy > 0;
+        if (attacker.owner != target.owner && attacker.count > 0 && inReach) {
+            damage += calculateAttackDamage(attacker.kind, attacker.count, target.type);
+        }
+    }
+    return damage;
+}
+
+} // namespace
+
+// Built with -msimd128 (`make simd-test`) this checks the i32x4 path; target
+// counts that are not multiples of four also cover the scalar tail
+NBD_TEST(combatKernelMatchesReference) {
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<int> coord(-Board::RADIUS - 1, Board::RADIUS + 1);
+    std::uniform_int_distribution<int> side(0, MAX_PLAYERS - 1);
+    std::uniform_int_distribution<int> count(-2, 60);
+    std::uniform_int_distribution<int> type(0, static_cast<int>(TargetType::COUNT) - 1);
+
+    CombatKernel kernel;
+    for (int round = 0; round < 200; ++round) {
+        kernel.clear();
+        std::vector<Attacker> attackers(rng() % 40);
+        std::vector<Target> targets(rng() % 70);
+        for (size_t i = 0; i < attackers.size(); ++i) {
+            Attacker& attacker = attackers[i];
+            attacker = { side(rng), rng() % 2 ? UnitKind::INFANTRY : UnitKind::LONG_RANGE,
+                         Position(coord(rng), coord(rng)), count(rng) };
+            kernel.addAttacker(attacker.owner, attacker.kind, attacker.position, attacker.count, static_cast<int32_t>(i));
+        }
+        for (size_t i = 0; i < targets.size(); ++i) {
+            Target& target = targets[i];
+            target = { side(rng), static_cast<TargetType>(type(rng)), Position(coord(rng), coord(rng)) };
+            CHECK(kernel.addTarget(target.owner, target.type, target.position, static_cast<int32_t>(i)) == i);
+        }
+
+        kernel.resolve();
+        CHECK(kernel.getTargetCount() == targets.size());
+        for (size_t i = 0; i < targets.size(); ++i) {
+            CHECK(kernel.getDamage(i) == referenceDamage(attackers, targets[i]));
+        }
+    }
+}
+
+NBD_TEST(combatKernelDeduplicates) {
+    CombatKernel kernel;
+    kernel.addAttacker(0, UnitKind::INFANTRY, Position(0, 0), 30, 1);
+    kernel.addAttacker(0, UnitKind::INFANTRY, Position(0, 0), 30, 1);
+    kernel.addAttacker(1, UnitKind::INFANTRY, Position(0, 0), 30, 1);
+    kernel.addAttacker(0, UnitKind::INFANTRY, Position(0, 0), 0, 2);
+    CHECK(kernel.getAttackerCount() == 2);
+
+    size_t target = kernel.addTarget(1, TargetType::INFANTRY, Position(1, 0), 5);
+    CHECK(kernel.addTarget(1, TargetType::INFANTRY, Position(1, 0), 5) == target);
+    CHECK(kernel.addTarget(1, TargetType::CORE, Position(1, 0), 5) != target);
+    CHECK(kernel.getTargetCount() == 2);
+
+    // Only the one enemy attacker hits, once
+    kernel.resolve();
+    CHECK(kernel.getDamage(target) == calculateAttackDamage(UnitKind::INFANTRY, 30, TargetType::INFANTRY));
+}
+
+namespace {
+
+// Player 1's first infantry group starts at `from` and moves to `to`, then
+// player 0's long range unit (at (0, -2), reaching (0, 0)) attacks (0, 0)
+// in the same turn; returns the group's HP lost
+int damageAfterMove(const Position& from, const Position& to) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    UnitStore& units = game.getPlayerMutable(1).getUnits();
+    units.setPosition(FIRST_INFANTRY_INDEX, from);
+    game.commitChanges();
+
+    const UnitStore& moved = game.getPlayer(1).getUnits();
+    UnitHandle group = moved.getHandle(FIRST_INFANTRY_INDEX);
+    UnitHandle longRange = game.getPlayer(0).getUnits().getHandle(0);
+    int hp = moved.getHp(FIRST_INFANTRY_INDEX);
+    CHECK(game.submitAction(1, ActionType::MOVE, to, group) == SubmitResult::ACCEPTED);
+    CHECK(game.submitAction(0, ActionType::ATTACK, Position(0, 0), longRange) == SubmitResult::ACCEPTED);
+    game.endTurn();
+
+    int index = moved.indexOf(group);
+    CHECK(index >= 0 && moved.getPosition(index) == to);
+    return index >= 0 ? hp - moved.getHp(index) : 0;
+}
+
+} // namespace
+
+// Attacks resolve against where units stand when the attack executes, not
+// where the Board last indexed them
+NBD_TEST(attackFollowsMovesInTheSameTurn) {
+    int hit = calculateAttackDamage(UnitKind::LONG_RANGE, 5, TargetType::INFANTRY);
+    CHECK(damageAfterMove(Position(0, 0), Position(0, 1)) == 0);
+    CHECK(damageAfterMove(Position(1, 0), Position(0, 0)) == hit);
+}
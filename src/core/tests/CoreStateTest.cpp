@@ -0,0 +1,39 @@
+#include "Test.h"
+
+NBD_TEST(fullQueueDoesNotBlockOtherPlayer) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    for (size_t i = 0; i < MAX_PENDING_ACTIONS_PER_PLAYER; ++i) {
+        CHECK(game.submitAction(0, ActionType::SPY, Position()) == SubmitResult::ACCEPTED);
+    }
+    CHECK(game.submitAction(0, ActionType::SPY, Position()) == SubmitResult::QUEUE_FULL);
+
+    // Player 1 still gets their whole share
+    for (size_t i = 0; i < MAX_PENDING_ACTIONS_PER_PLAYER; ++i) {
+        CHECK(game.submitAction(1, ActionType::SPY, Position()) == SubmitResult::ACCEPTED);
+    }
+    CHECK(game.submitAction(1, ActionType::SPY, Position()) == SubmitResult::QUEUE_FULL);
+    CHECK(game.getCoreState().pendingActions.size() == MAX_PENDING_ACTIONS);
+
+    // The shares free up once the turn resolves
+    game.endTurn();
+    CHECK(game.submitAction(1, ActionType::SPY, Position()) == SubmitResult::ACCEPTED);
+}
+
+NBD_TEST(restoreRewindsToClone) {
+    std::mt19937 rng(23);
+    std::vector<Action> actions;
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    playRandomTurn(game, rng, 2, actions);
+
+    CoreState saved;
+    game.clone(saved);
+    for (int turn = 0; turn < 5 && !game.isGameOver(); ++turn) {
+        playRandomTurn(game, rng, 2, actions);
+    }
+
+    CHECK(game.restore(saved));
+    CHECK(sameCoreState(game.getCoreState(), saved));
+    CHECK(game.getBoardView().getEntityCount() == game.getBoard().getEntityCount());
+}
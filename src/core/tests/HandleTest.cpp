@@ -0,0 +1,114 @@
+#include "Test.h"
+
+#include "CApi.h"
+
+NBD_TEST(unitStoreRejectsStaleHandles) {
+    UnitStore units;
+    UnitHandle first = units.add(UnitKind::INFANTRY, Position(0, 0), 10);
+    UnitHandle second = units.add(UnitKind::INFANTRY, Position(1, 0), 20);
+    CHECK(first != INVALID_UNIT_HANDLE && second != INVALID_UNIT_HANDLE && first != second);
+
+    CHECK(units.remove(first));
+    CHECK(units.indexOf(first) < 0);
+    CHECK(!units.remove(first));
+
+    // The last unit moved into the hole and keeps its handle
+    CHECK(units.indexOf(second) == 0);
+    CHECK(units.getCount(0) == 20);
+
+    // The freed slot is reused under a new generation
+    UnitHandle third = units.add(UnitKind::INFANTRY, Position(2, 0), 30);
+    CHECK(unitHandleSlot(third) == unitHandleSlot(first));
+    CHECK(third != first);
+    CHECK(units.indexOf(first) < 0);
+    CHECK(units.indexOf(third) >= 0 && units.getCount(units.indexOf(third)) == 30);
+
+    CHECK(units.indexOf(INVALID_UNIT_HANDLE) < 0);
+    CHECK(units.indexOf(makeUnitHandle(MAX_UNITS, 1)) < 0);
+
+    // Filling up returns the invalid handle instead of evicting anything
+    while (!units.full()) {
+        CHECK(units.add(UnitKind::INFANTRY, Position(0, 1), 1) != INVALID_UNIT_HANDLE);
+    }
+    CHECK(units.add(UnitKind::INFANTRY, Position(0, 1), 1) == INVALID_UNIT_HANDLE);
+    CHECK(units.indexOf(second) >= 0 && units.indexOf(third) >= 0);
+}
+
+NBD_TEST(gameRejectsStaleUnitHandles) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    Player& player = game.getPlayerMutable(0);
+    UnitHandle removed = player.getUnits().getHandle(FIRST_INFANTRY_INDEX);
+    Position from = player.getUnits().getPosition(FIRST_INFANTRY_INDEX);
+    Position step(from.x, from.y + 1);
+
+    CHECK(player.removeInfantryGroup(removed));
+    UnitHandle added = player.addInfantryGroup(from, 10);
+    game.commitChanges();
+    CHECK(unitHandleSlot(added) == unitHandleSlot(removed));
+
+    CHECK(game.submitAction(0, ActionType::MOVE, step, removed) == SubmitResult::INVALID_UNIT);
+    CHECK(game.submitAction(0, ActionType::MOVE, step, added) == SubmitResult::ACCEPTED);
+
+    // A unit with no count left keeps its handle but can no longer act
+    size_t dead = game.getPlayer(0).getUnits().size() - 1;
+    UnitHandle deadHandle = game.getPlayer(0).getUnits().getHandle(dead);
+    game.getPlayerMutable(0).getUnits().setCount(dead, 0);
+    game.commitChanges();
+    CHECK(game.submitAction(0, ActionType::MOVE, step, deadHandle) == SubmitResult::INVALID_UNIT);
+}
+
+NBD_TEST(capiRejectsStaleHandles) {
+    nbd_match first = nbd_create_match("Player 1", "Player 2");
+    CHECK(first != 0);
+    CHECK(nbd_get_turn(first) == 1);
+
+    nbd_destroy_match(first);
+    CHECK(nbd_get_turn(first) == NBD_INVALID_MATCH);
+    CHECK(nbd_end_turn(first) == NBD_INVALID_MATCH);
+    CHECK(nbd_submit_action(first, 0, static_cast<int32_t>(ActionType::SPY), 0, 0) == NBD_INVALID_MATCH);
+    CHECK(nbd_get_state(first) == nullptr);
+    nbd_destroy_match(first);
+
+    // The slot is reused, but the old handle still does not reach it
+    nbd_match second = nbd_create_match("Player 1", "Player 2");
+    CHECK(second != 0 && second != first);
+    CHECK((second & 0xFFFF) == (first & 0xFFFF));
+    CHECK(nbd_get_turn(first) == NBD_INVALID_MATCH);
+    CHECK(nbd_get_turn(second) == 1);
+
+    // Unit handles from a previous generation are rejected per action
+    GameState reference;
+    reference.initializeGame("Player 1", "Player 2");
+    UnitHandle live = reference.getPlayer(0).getUnits().getHandle(FIRST_INFANTRY_INDEX);
+    UnitHandle stale = makeUnitHandle(unitHandleSlot(live), unitHandleGeneration(live) + 1);
+    Position from = reference.getPlayer(0).getUnits().getPosition(FIRST_INFANTRY_INDEX);
+    int32_t move = static_cast<int32_t>(ActionType::MOVE);
+    int32_t tuples[] = {
+        0, move, from.x, from.y + 1, static_cast<int32_t>(stale),
+        0, move, from.x, from.y + 1, static_cast<int32_t>(live),
+    };
+    int32_t results[2] = { -1, -1 };
+    CHECK(nbd_submit_turn(second, tuples, 2, results) == 1);
+    CHECK(results[0] == static_cast<int32_t>(SubmitResult::INVALID_UNIT));
+    CHECK(results[1] == static_cast<int32_t>(SubmitResult::ACCEPTED));
+
+    nbd_destroy_match(second);
+    CHECK(nbd_get_turn(second) == NBD_INVALID_MATCH);
+}
+
+NBD_TEST(capiInvalidMatchIsNeverAResult) {
+    nbd_match match = nbd_create_match("Player 1", "Player 2");
+    nbd_destroy_match(match);
+
+    // A running match reports no winner as -1, which must stay distinct
+    nbd_match running = nbd_create_match("Player 1", "Player 2");
+    CHECK(nbd_get_winner(running) == -1);
+    CHECK(nbd_get_winner(match) == NBD_INVALID_MATCH);
+    CHECK(nbd_get_winner(match) != nbd_get_winner(running));
+    CHECK(nbd_get_phase(match) == NBD_INVALID_MATCH);
+    CHECK(nbd_get_metrics(match, nullptr, 0) == NBD_INVALID_MATCH);
+    CHECK(nbd_load_snapshot(match, nullptr, 0) == NBD_INVALID_MATCH);
+    CHECK(nbd_submit_turn(running, nullptr, -1, nullptr) == NBD_INVALID_MATCH);
+    nbd_destroy_match(running);
+}
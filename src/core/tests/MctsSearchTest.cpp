@@ -0,0 +1,57 @@
+#include "Test.h"
+
+#include "MctsSearch.h"
+
+NBD_TEST(mctsBeatsRandomPlayer) {
+    const int MATCHES = 12;
+    const int MAX_TURNS = 200;
+
+    MctsConfig config;
+    config.iterations = 50;
+    config.seed = 17;
+    MctsSearch search(config);
+
+    std::mt19937 rng(17);
+    std::vector<Action> planned;
+    std::vector<Action> actions;
+    int wins = 0;
+    int losses = 0;
+    for (int match = 0; match < MATCHES; ++match) {
+        // Alternate sides so neither starting position decides the result
+        int searcher = match % 2;
+        GameState game;
+        game.initializeGame("Player 1", "Player 2");
+        while (!game.isGameOver() && game.getCurrentTurn() <= MAX_TURNS) {
+            search.search(game, searcher, planned);
+            CHECK(!planned.empty());
+            for (const Action& action : planned) {
+                CHECK(action.playerId == searcher);
+                CHECK(game.submitAction(searcher, action.type, action.targetPos, action.unit) == SubmitResult::ACCEPTED);
+            }
+            submitRandomActions(game, 1 - searcher, rng, config.actionsPerTurn, actions);
+            game.endTurn();
+        }
+        if (game.isGameOver() && game.getWinner() == searcher) {
+            wins++;
+        } else if (game.isGameOver() && game.getWinner() == 1 - searcher) {
+            losses++;
+        }
+    }
+
+    // Far above chance; at this budget the searcher wins nearly every match
+    CHECK(wins * 4 >= MATCHES * 3);
+    CHECK(wins > losses * 3);
+}
+
+NBD_TEST(mctsIgnoresInvalidPlayer) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    MctsConfig config;
+    config.iterations = 10;
+    MctsSearch search(config);
+    std::vector<Action> planned(1);
+    search.search(game, MAX_PLAYERS, planned);
+    CHECK(planned.empty());
+    search.search(game, -1, planned);
+    CHECK(planned.empty());
+}
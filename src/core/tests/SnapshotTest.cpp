@@ -0,0 +1,164 @@
+#include "Test.h"
+
+#include <cstring>
+
+namespace {
+
+// Saving a loaded snapshot must give back the same bytes and the same state
+void checkRoundTrip(const GameState& game) {
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+
+    GameState loaded;
+    CHECK(loaded.loadSnapshot(saved.data(), saved.size()));
+
+    std::vector<uint8_t> resaved;
+    loaded.saveSnapshot(resaved);
+    CHECK(resaved == saved);
+    CHECK(sameCoreState(loaded.getCoreState(), game.getCoreState()));
+    CHECK(loaded.getCoreState().pendingActions.size() == game.getCoreState().pendingActions.size());
+    CHECK(loaded.getStateJson(false) == game.getStateJson(false));
+}
+
+} // namespace
+
+NBD_TEST(snapshotRoundTrip) {
+    std::mt19937 rng(7);
+    std::vector<Action> actions;
+    for (int match = 0; match < 10; ++match) {
+        GameState game;
+        game.initializeGame("Player \"1\"", "Player 2");
+        checkRoundTrip(game);
+
+        while (!game.isGameOver() && game.getCurrentTurn() <= 200) {
+            playRandomTurn(game, rng, 2, actions);
+            if (game.getCurrentTurn() % 10 == 0) {
+                checkRoundTrip(game);
+            }
+        }
+        checkRoundTrip(game);
+    }
+}
+
+NBD_TEST(snapshotKeepsPendingActions) {
+    std::mt19937 rng(11);
+    std::vector<Action> actions;
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    for (int turn = 0; turn < 3; ++turn) {
+        playRandomTurn(game, rng, 1, actions);
+    }
+    CHECK(!game.isGameOver());
+
+    // Both copies resolve the same queued turn identically
+    submitRandomActions(game, 0, rng, 2, actions);
+    submitRandomActions(game, 1, rng, 2, actions);
+    CHECK(!game.getCoreState().pendingActions.empty());
+    checkRoundTrip(game);
+
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+    GameState loaded;
+    CHECK(loaded.loadSnapshot(saved.data(), saved.size()));
+    game.endTurn();
+    loaded.endTurn();
+    CHECK(sameCoreState(loaded.getCoreState(), game.getCoreState()));
+}
+
+NBD_TEST(snapshotRejectsTruncatedData) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+
+    GameState loaded;
+    loaded.initializeGame("Other 1", "Other 2");
+    // Each rejection logs a warning; the loaded state must stay untouched
+    std::string before = loaded.getStateJson(false);
+    for (size_t size : { static_cast<size_t>(0), static_cast<size_t>(4), saved.size() / 2, saved.size() - 1 }) {
+        CHECK(!loaded.loadSnapshot(saved.data(), size));
+    }
+    CHECK(loaded.getStateJson(false) == before);
+}
+
+namespace {
+
+// A state that breaks a game rule must be refused by both load paths,
+// leaving the game it was loaded into untouched
+template <typename Corrupt>
+void checkRejected(Corrupt corrupt) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    corrupt(game);
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+    std::string json = game.getStateJson(false);
+
+    GameState loaded;
+    loaded.initializeGame("Other 1", "Other 2");
+    std::string before = loaded.getStateJson(false);
+    CHECK(!loaded.loadSnapshot(saved.data(), saved.size()));
+    CHECK(!loaded.deserializeState(json));
+    CHECK(loaded.getStateJson(false) == before);
+}
+
+} // namespace
+
+NBD_TEST(snapshotRejectsBrokenRules) {
+    // Off the diamond (|x| + |y| > 8)
+    checkRejected([](GameState& game) {
+        game.getPlayerMutable(1).getUnits().setPosition(FIRST_INFANTRY_INDEX, Position(5, 5));
+    });
+    checkRejected([](GameState& game) {
+        game.getPlayerMutable(0).addNode(Node(NodeType::COMMS, Position(8, -1), 50, 50));
+    });
+
+    // HP above the maximum (UnitStore::setHp clamps, so lower the maximum)
+    // and negative counts
+    checkRejected([](GameState& game) {
+        UnitStore& units = game.getPlayerMutable(0).getUnits();
+        units.setMaxHp(0, units.getHp(0) - 1);
+    });
+    checkRejected([](GameState& game) {
+        game.getPlayerMutable(1).addNode(Node(NodeType::CORE, Position(0, 6), 60, 50));
+    });
+    checkRejected([](GameState& game) {
+        game.getPlayerMutable(1).getUnits().setCount(FIRST_INFANTRY_INDEX, -5);
+    });
+}
+
+NBD_TEST(snapshotRejectsTooManyInfantryGroups) {
+    GameState game;
+    game.initializeGame("A", "B");
+    Player& player = game.getPlayerMutable(0);
+    while (player.getInfantryCount() < MAX_INFANTRY_GROUPS) {
+        CHECK(player.addInfantryGroup(Position(0, -1), 5) != INVALID_UNIT_HANDLE);
+    }
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+    GameState loaded;
+    CHECK(loaded.loadSnapshot(saved.data(), saved.size()));
+
+    // Splice one more group record after player 0's last one: header, four
+    // match ints, then id, intel, name "A", node count and three nodes
+    const size_t GROUP_BYTES = 6 * sizeof(int32_t);
+    size_t countOffset = 12 + 4 * sizeof(int32_t) + 2 * sizeof(int32_t) + sizeof(uint32_t) + 1 +
+                         sizeof(int32_t) + NODE_TYPE_COUNT * GROUP_BYTES;
+    int32_t count = 0;
+    std::memcpy(&count, saved.data() + countOffset, sizeof(count));
+    CHECK(count == static_cast<int32_t>(MAX_INFANTRY_GROUPS));
+
+    size_t groupsEnd = countOffset + sizeof(int32_t) + count * GROUP_BYTES;
+    std::vector<uint8_t> group(saved.begin() + (groupsEnd - GROUP_BYTES), saved.begin() + groupsEnd);
+    int32_t freshHandle = 0;
+    std::memcpy(group.data(), &freshHandle, sizeof(freshHandle));
+    saved.insert(saved.begin() + groupsEnd, group.begin(), group.end());
+    count++;
+    std::memcpy(saved.data() + countOffset, &count, sizeof(count));
+    uint32_t totalSize = static_cast<uint32_t>(saved.size());
+    std::memcpy(saved.data() + 8, &totalSize, sizeof(totalSize));
+
+    std::string before = loaded.getStateJson(false);
+    CHECK(!loaded.loadSnapshot(saved.data(), saved.size()));
+    CHECK(loaded.getStateJson(false) == before);
+}
@@ -0,0 +1,217 @@
+#include "Test.h"
+
+#include <map>
+#include <string>
+#include "JsonReader.h"
+
+namespace {
+
+const char* const NODE_KEYS[] = { "core", "comms", "rd" };
+
+// What a client keeps of the state, built either from a full state or by
+// applying deltas; every JSON field is stored as its serialized text
+struct ClientPlayer {
+    std::map<std::string, std::string> fields;              // name, intelPoints
+    std::map<std::string, std::map<std::string, std::string>> nodes;
+    std::vector<std::map<std::string, std::string>> infantry;
+    std::map<std::string, std::string> longRange;
+};
+
+struct ClientState {
+    std::map<std::string, std::string> fields;              // currentTurn, phase, winner
+    std::vector<ClientPlayer> players;
+    std::map<int, std::string> log;                         // By sequence number
+};
+
+std::string text(const JsonValue& value) {
+    int number = 0;
+    bool flag = false;
+    std::string str;
+    if (value.getInt(number)) {
+        return std::to_string(number);
+    }
+    if (value.getBool(flag)) {
+        return flag ? "true" : "false";
+    }
+    return value.getString(str) ? "\"" + str + "\"" : "?";
+}
+
+void copyFields(const JsonValue& object, std::initializer_list<const char*> keys, std::map<std::string, std::string>& out) {
+    for (const char* key : keys) {
+        if (const JsonValue* value = object.find(key)) {
+            out[key] = text(*value);
+        }
+    }
+}
+
+void copyUnit(const JsonValue& unit, std::map<std::string, std::string>& out) {
+    copyFields(unit, { "id", "posX", "posY", "count", "hp", "maxHp" }, out);
+}
+
+void copyNodes(const JsonValue& nodes, ClientPlayer& out) {
+    for (const char* key : NODE_KEYS) {
+        if (const JsonValue* node = nodes.find(key)) {
+            copyFields(*node, { "type", "posX", "posY", "hp", "maxHp", "defended" }, out.nodes[key]);
+        }
+    }
+}
+
+void copyLog(const JsonValue& root, ClientState& out) {
+    int start = 0;
+    const JsonValue* logStart = root.find("gameLogStart");
+    const JsonValue* log = root.find("gameLog");
+    CHECK(logStart && logStart->getInt(start) && log);
+    if (!log) {
+        return;
+    }
+    for (const JsonValue& entry : log->getItems()) {
+        out.log[start++] = text(entry);
+    }
+}
+
+bool readFullState(const std::string& json, ClientState& out) {
+    JsonValue root;
+    if (!JsonValue::parse(json, root)) {
+        return false;
+    }
+    out = ClientState();
+    copyFields(root, { "currentTurn", "phase", "winner" }, out.fields);
+    for (const JsonValue& player : root.find("players")->getItems()) {
+        ClientPlayer client;
+        copyFields(player, { "name", "intelPoints" }, client.fields);
+        copyNodes(*player.find("nodes"), client);
+        for (const JsonValue& unit : player.find("infantry")->getItems()) {
+            client.infantry.emplace_back();
+            copyUnit(unit, client.infantry.back());
+        }
+        copyUnit(*player.find("longRange"), client.longRange);
+        out.players.push_back(client);
+    }
+    copyLog(root, out);
+    return true;
+}
+
+bool applyDelta(const std::string& json, ClientState& state) {
+    JsonValue root;
+    bool reset = false;
+    if (!JsonValue::parse(json, root) || !root.find("reset") || !root.find("reset")->getBool(reset)) {
+        return false;
+    }
+    if (reset) {
+        state = ClientState();
+    }
+    copyFields(root, { "currentTurn", "phase", "winner" }, state.fields);
+
+    const auto& players = root.find("players")->getItems();
+    state.players.resize(players.size());
+    for (size_t p = 0; p < players.size(); ++p) {
+        const JsonValue& player = players[p];
+        ClientPlayer& client = state.players[p];
+        copyFields(player, { "name", "intelPoints" }, client.fields);
+        copyNodes(*player.find("nodes"), client);
+
+        int infantryCount = 0;
+        CHECK(player.find("infantryCount")->getInt(infantryCount));
+        client.infantry.resize(infantryCount);
+        for (const JsonValue& unit : player.find("infantry")->getItems()) {
+            int index = -1;
+            CHECK(unit.find("index")->getInt(index) && index >= 0 && index < infantryCount);
+            if (index >= 0 && index < infantryCount) {
+                copyUnit(unit, client.infantry[index]);
+            }
+        }
+        if (const JsonValue* longRange = player.find("longRange")) {
+            copyUnit(*longRange, client.longRange);
+        }
+    }
+    copyLog(root, state);
+    return true;
+}
+
+// The client must hold the full state, including every retained log entry
+void checkMatchesFullState(const GameState& game, const ClientState& client) {
+    ClientState full;
+    CHECK(readFullState(game.getStateJson(true), full));
+    CHECK(client.fields == full.fields);
+    CHECK(client.players.size() == full.players.size());
+    for (size_t p = 0; p < client.players.size() && p < full.players.size(); ++p) {
+        CHECK(client.players[p].fields == full.players[p].fields);
+        CHECK(client.players[p].nodes == full.players[p].nodes);
+        CHECK(client.players[p].infantry == full.players[p].infantry);
+        CHECK(client.players[p].longRange == full.players[p].longRange);
+    }
+    for (const auto& entry : full.log) {
+        auto found = client.log.find(entry.first);
+        CHECK(found != client.log.end() && found->second == entry.second);
+    }
+}
+
+} // namespace
+
+NBD_TEST(stateDeltaAppliesToFullState) {
+    std::mt19937 rng(5);
+    std::vector<Action> actions;
+    for (int match = 0; match < 6; ++match) {
+        GameState game;
+        game.initializeGame("Player 1", "Player 2");
+
+        // A fresh client asks with version 0 and gets a reset
+        ClientState client;
+        uint32_t version = 0;
+        std::string delta;
+        auto poll = [&]() {
+            game.getStateDelta(version, delta);
+            CHECK(applyDelta(delta, client));
+            version = game.getStateVersion();
+            checkMatchesFullState(game, client);
+        };
+        poll();
+
+        // Poll after some submissions, some whole turns and some skipped turns
+        std::uniform_int_distribution<int> skip(0, 2);
+        while (!game.isGameOver() && game.getCurrentTurn() <= 150) {
+            submitRandomActions(game, 0, rng, 2, actions);
+            if (skip(rng) == 0) {
+                poll();
+            }
+            submitRandomActions(game, 1, rng, 2, actions);
+            game.endTurn();
+            if (skip(rng) != 0) {
+                poll();
+            }
+        }
+        poll();
+
+        // Nothing changed since the last poll
+        game.getStateDelta(version, delta);
+        JsonValue root;
+        CHECK(JsonValue::parse(delta, root));
+        CHECK(root.find("gameLog") && root.find("gameLog")->getItems().empty());
+    }
+}
+
+NBD_TEST(stateDeltaResetsAfterLoad) {
+    std::mt19937 rng(9);
+    std::vector<Action> actions;
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    for (int turn = 0; turn < 10; ++turn) {
+        playRandomTurn(game, rng, 2, actions);
+    }
+    std::vector<uint8_t> saved;
+    game.saveSnapshot(saved);
+
+    GameState other;
+    other.initializeGame("Other 1", "Other 2");
+    ClientState client;
+    CHECK(readFullState(other.getStateJson(true), client));
+    uint32_t version = other.getStateVersion();
+
+    // Loading replaces everything the client held, so the delta is a reset
+    CHECK(other.loadSnapshot(saved.data(), saved.size()));
+    std::string delta;
+    other.getStateDelta(version, delta);
+    CHECK(delta.find("\"reset\":true") != std::string::npos);
+    CHECK(applyDelta(delta, client));
+    checkMatchesFullState(other, client);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <random>
+#include <vector>
+#include "GameState.h"
+
+// Minimal harness for the native behaviour tests (`make test`). Each test
+// file defines its cases with NBD_TEST; CHECK records a failure and lets the
+// case carry on, so one run reports every broken property.
+
+using TestFunction = void (*)();
+
+struct TestRegistrar {
+    TestRegistrar(const char* name, TestFunction run);
+};
+
+void reportFailure(const char* file, int line, const char* expression);
+
+#define NBD_TEST(name) \
+    static void name(); \
+    static const TestRegistrar name##Registrar(#name, name); \
+    static void name()
+
+#define CHECK(expression) \
+    do { \
+        if (!(expression)) { \
+            reportFailure(__FILE__, __LINE__, #expression); \
+        } \
+    } while (0)
+
+// Shared match driver: each player submits `actions` uniformly random legal
+// actions (scratch is reused between calls), then the turn ends
+void playRandomTurn(GameState& game, std::mt19937& rng, int actions, std::vector<Action>& scratch);
+void submitRandomActions(GameState& game, int playerId, std::mt19937& rng, int actions, std::vector<Action>& scratch);
+
+// Field-by-field equality of everything turn resolution reads or writes,
+// except the pending actions
+bool sameCoreState(const CoreState& a, const CoreState& b);
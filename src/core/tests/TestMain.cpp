@@ -0,0 +1,111 @@
+// Runner for the native behaviour tests.
+//
+// Usage:
+//   nbd_test [NAME_SUBSTRING]
+//
+// Runs every registered test (or those whose name contains the argument)
+// and exits non-zero if any check failed.
+
+#include "Test.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+struct TestCase {
+    const char* name;
+    TestFunction run;
+};
+
+std::vector<TestCase>& registry() {
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+int g_failures = 0;
+
+bool sameUnits(const UnitStore& a, const UnitStore& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a.getHandle(i) != b.getHandle(i) || a.getKind(i) != b.getKind(i) ||
+            !(a.getPosition(i) == b.getPosition(i)) || a.getCount(i) != b.getCount(i) ||
+            a.getHp(i) != b.getHp(i) || a.getMaxHp(i) != b.getMaxHp(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TestRegistrar::TestRegistrar(const char* name, TestFunction run) {
+    registry().push_back({ name, run });
+}
+
+void reportFailure(const char* file, int line, const char* expression) {
+    std::cerr << file << ":" << line << ": CHECK(" << expression << ") failed" << std::endl;
+    g_failures++;
+}
+
+void submitRandomActions(GameState& game, int playerId, std::mt19937& rng, int actions, std::vector<Action>& scratch) {
+    for (int i = 0; i < actions; ++i) {
+        game.getLegalActions(playerId, scratch);
+        if (scratch.empty()) {
+            return;
+        }
+        std::uniform_int_distribution<size_t> pick(0, scratch.size() - 1);
+        const Action& action = scratch[pick(rng)];
+        game.submitAction(playerId, action.type, action.targetPos, action.unit);
+    }
+}
+
+void playRandomTurn(GameState& game, std::mt19937& rng, int actions, std::vector<Action>& scratch) {
+    for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+        submitRandomActions(game, playerId, rng, actions, scratch);
+    }
+    game.endTurn();
+}
+
+bool sameCoreState(const CoreState& a, const CoreState& b) {
+    if (a.currentTurn != b.currentTurn || a.phase != b.phase || a.winner != b.winner) {
+        return false;
+    }
+    for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+        const Player& x = a.players[playerId];
+        const Player& y = b.players[playerId];
+        if (x.getIntelPoints() != y.getIntelPoints() || x.getAliveNodeMask() != y.getAliveNodeMask() ||
+            x.getNodes().size() != y.getNodes().size() || !sameUnits(x.getUnits(), y.getUnits())) {
+            return false;
+        }
+        for (size_t i = 0; i < x.getNodes().size(); ++i) {
+            const Node& n = x.getNodes()[i];
+            const Node& m = y.getNodes()[i];
+            if (n.getType() != m.getType() || !(n.getPosition() == m.getPosition()) || n.getHp() != m.getHp() ||
+                n.getMaxHp() != m.getMaxHp() || n.isDefended() != m.isDefended()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+
+    int run = 0;
+    for (const TestCase& test : registry()) {
+        if (filter && !std::strstr(test.name, filter)) {
+            continue;
+        }
+        int before = g_failures;
+        test.run();
+        run++;
+        std::cout << (g_failures == before ? "ok   " : "FAIL ") << test.name << std::endl;
+    }
+
+    std::cout << run << " tests, " << g_failures << " failed checks" << std::endl;
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include "Test.h"
+
+#include <set>
+#include <string>
+#include <utility>
+#include "JsonReader.h"
+
+namespace {
+
+const char* const VIEWER = "Alice";
+const char* const ENEMY = "Bob";
+
+bool startsWith(const std::string& text, const std::string& prefix) {
+    return text.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool readPosition(const JsonValue& entity, std::pair<int, int>& out) {
+    const JsonValue* x = entity.find("posX");
+    const JsonValue* y = entity.find("posY");
+    return x && y && x->getInt(out.first) && y->getInt(out.second);
+}
+
+// Player 0's view must hold nothing only player 1 knows: no enemy entity
+// off the visible cells, no enemy intel, no log entry of the enemy's own
+void checkFoggedView(const GameState& game) {
+    JsonValue root;
+    CHECK(JsonValue::parse(game.getPlayerState(0), root));
+    const JsonValue* cells = root.find("visibleCells");
+    const JsonValue* players = root.find("players");
+    const JsonValue* log = root.find("gameLog");
+    CHECK(cells && players && log && players->getItems().size() == MAX_PLAYERS);
+    if (!cells || !players || !log || players->getItems().size() != MAX_PLAYERS) {
+        return;
+    }
+
+    std::set<std::pair<int, int>> visible;
+    const std::vector<JsonValue>& coords = cells->getItems();
+    for (size_t i = 0; i + 1 < coords.size(); i += 2) {
+        std::pair<int, int> cell;
+        CHECK(coords[i].getInt(cell.first) && coords[i + 1].getInt(cell.second));
+        visible.insert(cell);
+    }
+
+    const JsonValue& enemy = players->getItems()[1];
+    CHECK(players->getItems()[0].find("intelPoints"));
+    CHECK(!enemy.find("intelPoints"));
+    std::vector<const JsonValue*> entities;
+    for (const JsonValue& unit : enemy.find("infantry")->getItems()) {
+        entities.push_back(&unit);
+    }
+    entities.push_back(enemy.find("longRange"));
+    for (const char* key : { "core", "comms", "rd" }) {
+        entities.push_back(enemy.find("nodes")->find(key));
+    }
+    for (const JsonValue* entity : entities) {
+        std::pair<int, int> position;
+        CHECK(!entity || (readPosition(*entity, position) && visible.count(position)));
+    }
+
+    // The enemy shows up only acting on the viewer
+    std::string attacked = std::string(ENEMY) + " attacked " + VIEWER;
+    std::string hacked = std::string(ENEMY) + " hacked " + VIEWER + "'s ";
+    for (const JsonValue& entry : log->getItems()) {
+        std::string text;
+        CHECK(entry.getString(text));
+        CHECK(!startsWith(text, ENEMY) || text == attacked || startsWith(text, hacked));
+    }
+}
+
+} // namespace
+
+NBD_TEST(foggedStateHidesEnemyOnlyInfo) {
+    std::mt19937 rng(5);
+    std::vector<Action> actions;
+    GameState game;
+    game.initializeGame(VIEWER, ENEMY);
+    checkFoggedView(game);
+
+    int turns = 0;
+    while (!game.isGameOver() && turns++ < 60) {
+        playRandomTurn(game, rng, 3, actions);
+        checkFoggedView(game);
+    }
+
+    // The full state still has everything the fogged one left out
+    const std::string& full = game.getStateJson();
+    CHECK(full.find(std::string("\"") + ENEMY + " submitted action") != std::string::npos);
+    CHECK(game.getPlayerState(0).find(std::string(ENEMY) + " submitted action") == std::string::npos);
+}
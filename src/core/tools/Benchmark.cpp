@@ -0,0 +1,600 @@
+// Micro-benchmarks for the turn-resolution and serialization hot paths.
+//
+// Every benchmark runs its operation in fixed-size batches; the per-batch
+// setup is untimed and the operation itself is timed and allocation-counted.
+// Results are reported as ns/op, allocations/op and bytes/op.
+//
+// Usage:
+//   nbd_bench [--filter SUBSTR] [--min-time SEC]
+//             [--save FILE] [--compare FILE] [--threshold PCT]
+//
+// --save writes the results as a baseline file; --compare reads one and
+// exits non-zero when any benchmark is slower, or allocates more, than the
+// baseline by more than the threshold (default 15%).
+
+#include "CApi.h"
+#include "GameState.h"
+#include "MctsSearch.h"
+#include "TurnArena.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Allocation counting
+// ---------------------------------------------------------------------------
+
+namespace {
+
+bool g_countAllocations = false;
+unsigned long long g_allocationCount = 0;
+unsigned long long g_allocationBytes = 0;
+
+void* countedAllocate(std::size_t size) {
+    if (g_countAllocations) {
+        g_allocationCount++;
+        g_allocationBytes += size;
+    }
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAllocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAllocate(size); } catch (...) { return nullptr; }
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+// ---------------------------------------------------------------------------
+// Access to GameState internals (declared as a friend in GameState.h)
+// ---------------------------------------------------------------------------
+
+class GameStateBenchmark {
+public:
+    static bool isValidAction(const GameState& game, int playerId, ActionType actionType,
+                              const Position& targetPos) {
+        return game.isValidAction(playerId, actionType, targetPos);
+    }
+
+    static void executeAction(GameState& game, int playerId, ActionType actionType,
+                              const Position& targetPos) {
+        // Outside processActions there is no turn kernel; attacks queue into
+        // a fresh one on the arena, as in a turn
+        TurnArena::reset();
+        CombatKernel combat(TurnArena::resource());
+        game.m_combat = &combat;
+        game.executeAction({playerId, actionType, targetPos, INVALID_UNIT_HANDLE});
+        game.m_combat = nullptr;
+    }
+
+    static void queueAction(GameState& game, int playerId, ActionType actionType,
+                            const Position& targetPos) {
+        game.m_core.pendingActions.push_back({playerId, actionType, targetPos, INVALID_UNIT_HANDLE});
+    }
+
+    static void writeState(const GameState& game, std::string& out, int viewerId) {
+        game.writeState(out, true, viewerId);
+    }
+
+    static void clearPendingActions(GameState& game) {
+        game.m_core.pendingActions.clear();
+    }
+
+    static void addLogEntries(GameState& game, int count) {
+        for (int i = 0; i < count; ++i) {
+            game.logEvent(EventCode::ACTION_SUBMITTED, 0, -1, static_cast<int>(ActionType::SPY));
+        }
+    }
+};
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Harness
+// ---------------------------------------------------------------------------
+
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct Fixture {
+    GameState game;
+    GameState copy;
+    CoreState core;
+    std::string buffer;
+    std::vector<uint8_t> snapshot;
+    uint32_t version = 0;
+    MctsSearch search;
+    std::vector<Action> actions;
+    std::vector<int32_t> tuples;
+    std::vector<int32_t> results;
+    CombatKernel combat;
+    Metrics::Array metrics;
+    nbd_match match = 0;
+
+    Fixture() = default;
+    Fixture(const Fixture&) = delete;
+    Fixture& operator=(const Fixture&) = delete;
+    ~Fixture() { nbd_destroy_match(match); }
+};
+
+struct Benchmark {
+    std::string name;
+    int batchSize;
+    std::function<void(Fixture&)> setup;
+    std::function<void(Fixture&)> op;
+};
+
+struct Result {
+    std::string name;
+    double nsPerOp;
+    double allocsPerOp;
+    double bytesPerOp;
+};
+
+struct Options {
+    std::string filter;
+    double minTime = 0.25;
+    std::string savePath;
+    std::string comparePath;
+    double threshold = 15.0;
+};
+
+Result runBenchmark(const Benchmark& bench, double minTime) {
+    Fixture fixture;
+    unsigned long long ops = 0;
+    unsigned long long allocations = 0;
+    unsigned long long bytes = 0;
+    double elapsedNs = 0.0;
+
+    // Warm-up batch (untimed)
+    bench.setup(fixture);
+    for (int i = 0; i < bench.batchSize; ++i) {
+        bench.op(fixture);
+    }
+
+    while (elapsedNs < minTime * 1e9) {
+        bench.setup(fixture);
+
+        g_allocationCount = 0;
+        g_allocationBytes = 0;
+        g_countAllocations = true;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < bench.batchSize; ++i) {
+            bench.op(fixture);
+        }
+        auto end = std::chrono::steady_clock::now();
+        g_countAllocations = false;
+
+        elapsedNs += std::chrono::duration<double, std::nano>(end - start).count();
+        allocations += g_allocationCount;
+        bytes += g_allocationBytes;
+        ops += bench.batchSize;
+    }
+
+    return { bench.name, elapsedNs / ops,
+             static_cast<double>(allocations) / ops,
+             static_cast<double>(bytes) / ops };
+}
+
+// ---------------------------------------------------------------------------
+// Fixtures
+// ---------------------------------------------------------------------------
+
+const int STRESS_INFANTRY_GROUPS = static_cast<int>(MAX_INFANTRY_GROUPS);
+const int STRESS_LOG_ENTRIES = 10000;
+const int STRESS_ACTIONS_PER_PLAYER = 16;
+const int LONG_MATCH_TURNS = 500;
+
+void setupRealistic(Fixture& fixture) {
+    fixture.game.initializeGame("Player 1", "Player 2");
+    fixture.game.getPlayerMutable(0).setIntelPoints(1000000);
+    fixture.game.getPlayerMutable(1).setIntelPoints(1000000);
+    fixture.game.commitChanges();
+}
+
+void setupStress(Fixture& fixture) {
+    setupRealistic(fixture);
+    for (int playerId = 0; playerId < 2; ++playerId) {
+        Player& player = fixture.game.getPlayerMutable(playerId);
+        int row = playerId == 0 ? -1 : 1;
+        for (int i = static_cast<int>(player.getInfantryCount()); i < STRESS_INFANTRY_GROUPS; ++i) {
+            player.addInfantryGroup(Position(i % 13 - 6, row), 10);
+        }
+    }
+    GameStateBenchmark::addLogEntries(fixture.game, STRESS_LOG_ENTRIES);
+    fixture.game.commitChanges();
+}
+
+// One turn's worth of non-terminal actions for both players. Hacks target
+// the comms node so the match never ends mid-benchmark.
+template <typename Fn>
+void forEachTurnAction(int actionsPerPlayer, Fn fn) {
+    for (int playerId = 0; playerId < 2; ++playerId) {
+        int side = playerId == 0 ? -1 : 1;
+        for (int i = 0; i < actionsPerPlayer; ++i) {
+            ActionType type = static_cast<ActionType>(i % static_cast<int>(ActionType::COUNT));
+            Position target(0, 0);
+            if (type == ActionType::HACK) {
+                target = Position(-1, -3 * side);
+            } else if (type == ActionType::DEFEND) {
+                target = Position(1, 3 * side);
+            }
+            fn(playerId, type, target);
+        }
+    }
+}
+
+// Queue a turn without validation or logging
+void queueTurn(GameState& game, int actionsPerPlayer) {
+    forEachTurnAction(actionsPerPlayer, [&](int playerId, ActionType type, const Position& target) {
+        GameStateBenchmark::queueAction(game, playerId, type, target);
+    });
+}
+
+// Realistic match with one turn packed for GameState::submitActions
+void setupPackedTurn(Fixture& fixture) {
+    setupRealistic(fixture);
+    fixture.tuples.clear();
+    forEachTurnAction(STRESS_ACTIONS_PER_PLAYER, [&](int playerId, ActionType type, const Position& target) {
+        int32_t tuple[ACTION_TUPLE_WORDS] = { playerId, static_cast<int32_t>(type), target.x, target.y, 0 };
+        fixture.tuples.insert(fixture.tuples.end(), tuple, tuple + ACTION_TUPLE_WORDS);
+    });
+    fixture.results.resize(fixture.tuples.size() / ACTION_TUPLE_WORDS);
+}
+
+// Packed turn plus a fresh C ABI match to submit it to
+void setupCapiMatch(Fixture& fixture) {
+    setupPackedTurn(fixture);
+    nbd_destroy_match(fixture.match);
+    fixture.match = nbd_create_match("Player 1", "Player 2");
+}
+
+// A mass battle: `count` attackers and `count` targets per side scattered
+// over the board (fixed seed, so every run resolves the same battle)
+void setupCombat(Fixture& fixture, int count) {
+    fixture.combat.clear();
+    uint32_t seed = 12345;
+    auto next = [&seed](int range) {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<int>((seed >> 16) % static_cast<uint32_t>(range));
+    };
+    for (int i = 0; i < 2 * count; ++i) {
+        int owner = i % 2;
+        Position pos(next(2 * BOARD_RADIUS + 1) - BOARD_RADIUS, next(2 * BOARD_RADIUS + 1) - BOARD_RADIUS);
+        UnitKind kind = next(8) == 0 ? UnitKind::LONG_RANGE : UnitKind::INFANTRY;
+        fixture.combat.addAttacker(owner, kind, pos, 1 + next(45), i);
+        TargetType type = static_cast<TargetType>(next(5));
+        fixture.combat.addTarget(owner, type, pos, i);
+    }
+}
+
+// Realistic match played for LONG_MATCH_TURNS turns, so its journal spans
+// many checkpoints
+void setupLongMatch(Fixture& fixture) {
+    setupRealistic(fixture);
+    for (int turn = 0; turn < LONG_MATCH_TURNS; ++turn) {
+        queueTurn(fixture.game, 3);
+        fixture.game.processActions();
+    }
+}
+
+std::vector<Benchmark> makeBenchmarks() {
+    std::vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({ "serializeState/realistic", 256, setupRealistic,
+        [](Fixture& f) { f.game.serializeState(f.buffer); doNotOptimize(f.buffer); } });
+    benchmarks.push_back({ "serializeState/stress", 4, setupStress,
+        [](Fixture& f) { f.game.serializeState(f.buffer); doNotOptimize(f.buffer); } });
+    benchmarks.push_back({ "serializeState/compact/realistic", 256, setupRealistic,
+        [](Fixture& f) { f.game.serializeState(f.buffer, true); doNotOptimize(f.buffer); } });
+    benchmarks.push_back({ "serializeState/compact/stress", 4, setupStress,
+        [](Fixture& f) { f.game.serializeState(f.buffer, true); doNotOptimize(f.buffer); } });
+    // Fog-of-war view of one player, built uncached
+    benchmarks.push_back({ "serializeState/fogged/realistic", 256, setupRealistic,
+        [](Fixture& f) { GameStateBenchmark::writeState(f.game, f.buffer, 0); doNotOptimize(f.buffer); } });
+    // Repeated reads of an unchanged state hit the serialization cache
+    benchmarks.push_back({ "getStateJson/cached", 1024, setupRealistic,
+        [](Fixture& f) { doNotOptimize(f.game.getStateJson()); } });
+    benchmarks.push_back({ "getPlayerState/cached", 1024, setupRealistic,
+        [](Fixture& f) { doNotOptimize(f.game.getPlayerState(0)); } });
+    benchmarks.push_back({ "getSnapshot/cached", 1024, setupRealistic,
+        [](Fixture& f) { doNotOptimize(f.game.getSnapshot()); } });
+
+    // Delta for a client one turn behind (defend + spy + hack on both sides)
+    benchmarks.push_back({ "getStateDelta/one-turn", 256,
+        [](Fixture& f) {
+            setupStress(f);
+            f.version = f.game.getStateVersion();
+            queueTurn(f.game, 3);
+            f.game.processActions();
+        },
+        [](Fixture& f) { f.game.getStateDelta(f.version, f.buffer); doNotOptimize(f.buffer); } });
+
+    benchmarks.push_back({ "saveSnapshot/realistic", 256, setupRealistic,
+        [](Fixture& f) { f.game.saveSnapshot(f.snapshot); doNotOptimize(f.snapshot); } });
+    benchmarks.push_back({ "saveSnapshot/stress", 16, setupStress,
+        [](Fixture& f) { f.game.saveSnapshot(f.snapshot); doNotOptimize(f.snapshot); } });
+    benchmarks.push_back({ "loadSnapshot/realistic", 256,
+        [](Fixture& f) { setupRealistic(f); f.game.saveSnapshot(f.snapshot); },
+        [](Fixture& f) { f.game.loadSnapshot(f.snapshot.data(), f.snapshot.size()); } });
+    benchmarks.push_back({ "loadSnapshot/stress", 16,
+        [](Fixture& f) { setupStress(f); f.game.saveSnapshot(f.snapshot); },
+        [](Fixture& f) { f.game.loadSnapshot(f.snapshot.data(), f.snapshot.size()); } });
+
+    benchmarks.push_back({ "processActions/realistic", 256, setupRealistic,
+        [](Fixture& f) { queueTurn(f.game, 2); f.game.processActions(); } });
+    benchmarks.push_back({ "processActions/stress", 64, setupStress,
+        [](Fixture& f) { queueTurn(f.game, STRESS_ACTIONS_PER_PLAYER); f.game.processActions(); } });
+
+    // A full turn submitted action by action versus in one batch
+    benchmarks.push_back({ "submitAction/turn", 256, setupRealistic,
+        [](Fixture& f) {
+            forEachTurnAction(STRESS_ACTIONS_PER_PLAYER, [&](int playerId, ActionType type, const Position& target) {
+                f.game.submitAction(playerId, type, target);
+            });
+            GameStateBenchmark::clearPendingActions(f.game);
+        } });
+    benchmarks.push_back({ "submitActions/turn", 256, setupPackedTurn,
+        [](Fixture& f) {
+            doNotOptimize(f.game.submitActions(f.tuples.data(), f.results.size(), f.results.data()));
+            GameStateBenchmark::clearPendingActions(f.game);
+        } });
+
+    // Cost of the C ABI layer (handle lookup, pointer arguments) over calling
+    // GameState directly: a trivial getter, and a whole turn submitted and
+    // resolved. The Wasm-side comparison with Embind is measureCallOverhead
+    // in CoreApi.js.
+    benchmarks.push_back({ "getCurrentTurn/direct", 4096, setupCapiMatch,
+        [](Fixture& f) { doNotOptimize(f.game.getCurrentTurn()); } });
+    benchmarks.push_back({ "getCurrentTurn/capi", 4096, setupCapiMatch,
+        [](Fixture& f) { doNotOptimize(nbd_get_turn(f.match)); } });
+    benchmarks.push_back({ "submitTurn/direct", 256, setupCapiMatch,
+        [](Fixture& f) {
+            f.game.submitActions(f.tuples.data(), f.results.size(), f.results.data());
+            f.game.endTurn();
+        } });
+    benchmarks.push_back({ "submitTurn/capi", 256, setupCapiMatch,
+        [](Fixture& f) {
+            nbd_submit_turn(f.match, f.tuples.data(), static_cast<int32_t>(f.results.size()), f.results.data());
+            nbd_end_turn(f.match);
+        } });
+
+    for (int type = 0; type < static_cast<int>(ActionType::COUNT); ++type) {
+        ActionType actionType = static_cast<ActionType>(type);
+        std::string name = getActionTypeName(actionType);
+        Position target = actionType == ActionType::HACK ? Position(-1, 3)
+                        : actionType == ActionType::DEFEND ? Position(1, -3) : Position(0, 0);
+
+        benchmarks.push_back({ "executeAction/" + name, 256, setupRealistic,
+            [actionType, target](Fixture& f) {
+                GameStateBenchmark::executeAction(f.game, 0, actionType, target);
+            } });
+        benchmarks.push_back({ "isValidAction/" + name, 1024, setupRealistic,
+            [actionType, target](Fixture& f) {
+                doNotOptimize(GameStateBenchmark::isValidAction(f.game, 0, actionType, target));
+            } });
+    }
+
+    // Re-index (board, visibility, view) after one unit moves
+    benchmarks.push_back({ "commitChanges/one-move", 1024, setupRealistic,
+        [](Fixture& f) {
+            UnitStore& units = f.game.getPlayerMutable(0).getUnits();
+            Position pos = units.getPosition(0);
+            units.setPosition(0, Position(pos.x, pos.y == -2 ? -1 : -2));
+            f.game.commitChanges();
+        } });
+    benchmarks.push_back({ "Player::damageNode", 1024, setupRealistic,
+        [](Fixture& f) { f.game.getPlayerMutable(1).damageNode(NodeType::COMMS, 1); } });
+    benchmarks.push_back({ "UnitStore::damageArea/stress", 1024, setupStress,
+        [](Fixture& f) { doNotOptimize(f.game.getPlayerMutable(0).getUnits().damageArea(Position(0, 0), 3, 1)); } });
+    benchmarks.push_back({ "UnitStore::recomputeCounts/stress", 1024, setupStress,
+        [](Fixture& f) { f.game.getPlayerMutable(0).getUnits().recomputeCounts(); } });
+
+    benchmarks.push_back({ "CombatKernel::resolve/256x256", 16,
+        [](Fixture& f) { setupCombat(f, 128); },
+        [](Fixture& f) { f.combat.resolve(); doNotOptimize(f.combat.getDamage(0)); } });
+    benchmarks.push_back({ "CombatKernel::resolve/1024x1024", 4,
+        [](Fixture& f) { setupCombat(f, 512); },
+        [](Fixture& f) { f.combat.resolve(); doNotOptimize(f.combat.getDamage(0)); } });
+
+    benchmarks.push_back({ "GameState::copy/realistic", 256, setupRealistic,
+        [](Fixture& f) { f.copy = f.game; doNotOptimize(f.copy); } });
+    benchmarks.push_back({ "GameState::clone/realistic", 1024, setupRealistic,
+        [](Fixture& f) { f.game.clone(f.core); doNotOptimize(f.core); } });
+    benchmarks.push_back({ "GameState::restore/realistic", 256,
+        [](Fixture& f) { setupRealistic(f); f.game.clone(f.core); },
+        [](Fixture& f) { f.game.restore(f.core); } });
+    // Worst case: the turn just before a checkpoint, late in a long match
+    benchmarks.push_back({ "ActionJournal::seek/long-match", 64, setupLongMatch,
+        [](Fixture& f) {
+            const ActionJournal& journal = f.game.getJournal();
+            int turn = journal.getEndTurn() - 1;
+            turn -= (turn - journal.getFirstTurn() + 1) % ActionJournal::CHECKPOINT_INTERVAL;
+            doNotOptimize(journal.seek(turn, f.copy));
+        } });
+    benchmarks.push_back({ "getMetrics/realistic", 1024, setupRealistic,
+        [](Fixture& f) { f.game.getMetrics(f.metrics); doNotOptimize(f.metrics); } });
+    benchmarks.push_back({ "getLegalActions/realistic", 256, setupRealistic,
+        [](Fixture& f) { f.game.getLegalActions(0, f.actions); doNotOptimize(f.actions); } });
+
+    // One search from the opening position; reported per search
+    benchmarks.push_back({ "MctsSearch/1000-iterations", 1,
+        [](Fixture& f) {
+            f.game.initializeGame("Player 1", "Player 2");
+            MctsConfig config;
+            config.iterations = 1000;
+            f.search.setConfig(config);
+        },
+        [](Fixture& f) { f.search.search(f.game, 0, f.actions); doNotOptimize(f.actions); } });
+
+    return benchmarks;
+}
+
+// ---------------------------------------------------------------------------
+// Baseline files
+// ---------------------------------------------------------------------------
+
+bool saveBaseline(const std::string& path, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Cannot write baseline: " << path << std::endl;
+        return false;
+    }
+    out << "# name\tns_per_op\tallocs_per_op\tbytes_per_op\n";
+    for (const auto& result : results) {
+        out << result.name << "\t" << result.nsPerOp << "\t"
+            << result.allocsPerOp << "\t" << result.bytesPerOp << "\n";
+    }
+    return true;
+}
+
+bool loadBaseline(const std::string& path, std::map<std::string, Result>& baseline) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Cannot read baseline: " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        Result result;
+        if (std::getline(fields, result.name, '\t') &&
+            fields >> result.nsPerOp >> result.allocsPerOp >> result.bytesPerOp) {
+            baseline[result.name] = result;
+        }
+    }
+    return true;
+}
+
+bool isRegression(double current, double base, double threshold) {
+    return current > base * (1.0 + threshold / 100.0) && current - base > 1e-9;
+}
+
+// Prints the comparison table and returns the number of regressions
+int compareResults(const std::vector<Result>& results, const std::map<std::string, Result>& baseline,
+                   double threshold) {
+    int regressions = 0;
+    std::cout << "\nComparison against baseline (threshold " << threshold << "%)\n";
+    for (const auto& result : results) {
+        auto it = baseline.find(result.name);
+        if (it == baseline.end()) {
+            std::cout << "  " << std::left << std::setw(32) << result.name << " new\n";
+            continue;
+        }
+        const Result& base = it->second;
+        double deltaPct = base.nsPerOp > 0.0 ? (result.nsPerOp / base.nsPerOp - 1.0) * 100.0 : 0.0;
+        bool slower = isRegression(result.nsPerOp, base.nsPerOp, threshold);
+        bool moreAllocs = isRegression(result.allocsPerOp, base.allocsPerOp, threshold);
+
+        std::cout << "  " << std::left << std::setw(32) << result.name
+                  << std::right << std::showpos << std::fixed << std::setprecision(1)
+                  << std::setw(8) << deltaPct << "%" << std::noshowpos
+                  << "  allocs " << base.allocsPerOp << " -> " << result.allocsPerOp;
+        if (slower || moreAllocs) {
+            std::cout << "  REGRESSION";
+            regressions++;
+        }
+        std::cout << "\n";
+    }
+    return regressions;
+}
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [--filter SUBSTR] [--min-time SEC]"
+              << " [--save FILE] [--compare FILE] [--threshold PCT]" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--min-time") == 0 && hasValue) {
+            options.minTime = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--save") == 0 && hasValue) {
+            options.savePath = argv[++i];
+        } else if (std::strcmp(arg, "--compare") == 0 && hasValue) {
+            options.comparePath = argv[++i];
+        } else if (std::strcmp(arg, "--threshold") == 0 && hasValue) {
+            options.threshold = std::atof(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return options.minTime > 0.0 && options.threshold >= 0.0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::map<std::string, Result> baseline;
+    if (!options.comparePath.empty() && !loadBaseline(options.comparePath, baseline)) {
+        return 2;
+    }
+
+    std::vector<Result> results;
+    std::cout << std::left << std::setw(34) << "benchmark" << std::right
+              << std::setw(14) << "ns/op" << std::setw(14) << "allocs/op"
+              << std::setw(14) << "bytes/op" << "\n";
+
+    for (const auto& bench : makeBenchmarks()) {
+        if (!options.filter.empty() && bench.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        Result result = runBenchmark(bench, options.minTime);
+        results.push_back(result);
+
+        std::cout << std::left << std::setw(34) << result.name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14) << result.nsPerOp
+                  << std::setprecision(2) << std::setw(14) << result.allocsPerOp
+                  << std::setprecision(1) << std::setw(14) << result.bytesPerOp << std::endl;
+    }
+
+    if (!options.savePath.empty() && !saveBaseline(options.savePath, results)) {
+        return 2;
+    }
+
+    if (!options.comparePath.empty()) {
+        int regressions = compareResults(results, baseline, options.threshold);
+        if (regressions > 0) {
+            std::cout << regressions << " regression(s) beyond " << options.threshold << "%" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
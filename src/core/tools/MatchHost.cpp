@@ -0,0 +1,206 @@
+// Load driver for MatchManager.
+//
+// Hosts many random matches on a worker pool and reports turn throughput and
+// turn-resolution latency for every combination of worker and match counts.
+// Each round queues one turn for every live match and waits for the pool to
+// drain, so latency includes the time a turn spends queued behind others.
+//
+// Usage:
+//   nbd_host [--threads N,N,...] [--matches N,N,...] [--max-turns N] [--actions N] [--seed N]
+
+#include "MatchManager.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::vector<int> threads;
+    std::vector<int> matches = { 100, 1000, 10000 };
+    int maxTurns = 200;
+    int actionsPerTurn = 1;
+    unsigned int seed = 1;
+};
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program
+              << " [--threads N,N,...] [--matches N,N,...] [--max-turns N] [--actions N] [--seed N]"
+              << std::endl;
+}
+
+bool parseList(const char* text, std::vector<int>& out) {
+    out.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        int value = std::atoi(item.c_str());
+        if (value <= 0) {
+            return false;
+        }
+        out.push_back(value);
+    }
+    return !out.empty();
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            if (!parseList(argv[++i], options.threads)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--matches") == 0 && hasValue) {
+            if (!parseList(argv[++i], options.matches)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--max-turns") == 0 && hasValue) {
+            options.maxTurns = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--actions") == 0 && hasValue) {
+            options.actionsPerTurn = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+
+    if (options.threads.empty()) {
+        // 1, 2, 4, ... up to the hardware concurrency
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        for (int count = 1; count < cores; count *= 2) {
+            options.threads.push_back(count);
+        }
+        options.threads.push_back(cores > 0 ? cores : 1);
+    }
+    return options.maxTurns > 0 && options.actionsPerTurn >= 0;
+}
+
+// Node positions never change, so clients can target them without reading
+// match state (which is owned by the workers)
+struct NodeTargets {
+    std::array<std::vector<Position>, MAX_PLAYERS> positions;
+};
+
+NodeTargets findNodeTargets() {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    NodeTargets targets;
+    for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+        for (const auto& node : game.getPlayer(playerId).getNodes()) {
+            targets.positions[playerId].push_back(node.getPosition());
+        }
+    }
+    return targets;
+}
+
+Position randomCell(std::mt19937& rng) {
+    std::uniform_int_distribution<int> coord(-Board::RADIUS, Board::RADIUS);
+    Position pos;
+    do {
+        pos = Position(coord(rng), coord(rng));
+    } while (!Board::isValid(pos));
+    return pos;
+}
+
+// Same random policy as nbd_sim
+void submitRandomAction(MatchManager& manager, uint32_t matchId, int playerId,
+                        const NodeTargets& targets, std::mt19937& rng) {
+    std::uniform_int_distribution<int> pickAction(0, static_cast<int>(ActionType::COUNT) - 1);
+    ActionType actionType = static_cast<ActionType>(pickAction(rng));
+
+    Position target;
+    if (actionType == ActionType::HACK || actionType == ActionType::DEFEND) {
+        const auto& nodes = targets.positions[actionType == ActionType::HACK ? 1 - playerId : playerId];
+        std::uniform_int_distribution<size_t> pick(0, nodes.size() - 1);
+        target = nodes[pick(rng)];
+    } else {
+        target = randomCell(rng);
+    }
+
+    manager.submitAction(matchId, playerId, actionType, target);
+}
+
+void runConfiguration(const Options& options, const NodeTargets& targets, int threadCount, int matchCount) {
+    MatchManager manager(threadCount);
+    std::vector<uint32_t> live;
+    for (int i = 0; i < matchCount; ++i) {
+        live.push_back(manager.createMatch("Player 1", "Player 2"));
+    }
+
+    std::mt19937 rng(options.seed);
+    auto start = std::chrono::steady_clock::now();
+    while (!live.empty()) {
+        for (uint32_t matchId : live) {
+            for (int playerId = 0; playerId < MAX_PLAYERS; ++playerId) {
+                for (int i = 0; i < options.actionsPerTurn; ++i) {
+                    submitRandomAction(manager, matchId, playerId, targets, rng);
+                }
+            }
+            manager.endTurn(matchId);
+        }
+        manager.drain();
+
+        size_t kept = 0;
+        for (uint32_t matchId : live) {
+            if (!manager.isMatchOver(matchId) && manager.getMatchTurn(matchId) <= options.maxTurns) {
+                live[kept++] = matchId;
+            }
+        }
+        live.resize(kept);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    if (seconds <= 0.0) {
+        seconds = 1e-9;
+    }
+
+    MatchManagerStats stats = manager.getStats();
+    std::cout << std::setw(8) << threadCount
+              << std::setw(10) << matchCount
+              << std::setw(12) << stats.turnsResolved
+              << std::setw(14) << std::fixed << std::setprecision(0) << stats.turnsResolved / seconds
+              << std::setw(12) << std::setprecision(1) << stats.p50LatencyUs
+              << std::setw(12) << stats.p99LatencyUs
+              << std::setw(12) << stats.maxLatencyUs
+              << std::setw(12) << std::setprecision(2) << stats.p99ResolveUs << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    NodeTargets targets = findNodeTargets();
+
+    std::cout << std::setw(8) << "threads"
+              << std::setw(10) << "matches"
+              << std::setw(12) << "turns"
+              << std::setw(14) << "turns/sec"
+              << std::setw(12) << "p50 us"
+              << std::setw(12) << "p99 us"
+              << std::setw(12) << "max us"
+              << std::setw(12) << "p99 run us" << std::endl;
+    for (int matchCount : options.matches) {
+        for (int threadCount : options.threads) {
+            runConfiguration(options, targets, threadCount, matchCount);
+        }
+    }
+    return 0;
+}
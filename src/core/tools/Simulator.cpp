@@ -0,0 +1,287 @@
+// Headless match driver for the native build of the game core.
+//
+// Plays scripted or random matches through GameState::submitAction and
+// GameState::processActions at full native speed and reports throughput.
+//
+// Usage:
+//   nbd_sim [--matches N] [--max-turns N] [--actions N] [--seed N] [--mcts N]
+//   nbd_sim --script FILE [--verbose]
+//
+// Any run also takes --trace FILE, which writes the spans recorded during
+// the run as Chrome trace-event JSON (needs a `make TRACE=1` build; the
+// ring buffer keeps the last Trace::CAPACITY spans).
+//
+// With --mcts N, player 0 is driven by MctsSearch with N iterations per turn
+// instead of the random policy. Random runs fail if any turn outgrew the
+// turn arena (Metrics::WORD_ARENA_HEAP_ALLOCATIONS).
+//
+// Script files contain one command per line ('#' starts a comment):
+//   submit <playerId> <actionType> <x> <y>
+//   end
+
+#include "GameState.h"
+#include "MctsSearch.h"
+#include "Trace.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    int matches = 1000;
+    int maxTurns = 200;
+    int actionsPerTurn = 1;
+    unsigned int seed = 1;
+    int mctsIterations = 0;
+    std::string scriptPath;
+    std::string tracePath;
+    bool verbose = false;
+};
+
+struct Totals {
+    long long matches = 0;
+    long long turns = 0;
+    long long actions = 0;
+    long long wins[2] = { 0, 0 };
+    long long draws = 0;
+    double arenaHeapAllocations = 0; // Turn arena overflows on this thread
+};
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program
+              << " [--matches N] [--max-turns N] [--actions N] [--seed N] [--mcts N]"
+              << " [--script FILE] [--verbose] [--trace FILE]" << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--matches") == 0 && hasValue) {
+            options.matches = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--max-turns") == 0 && hasValue) {
+            options.maxTurns = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--actions") == 0 && hasValue) {
+            options.actionsPerTurn = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--mcts") == 0 && hasValue) {
+            options.mctsIterations = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--script") == 0 && hasValue) {
+            options.scriptPath = argv[++i];
+        } else if (std::strcmp(arg, "--trace") == 0 && hasValue) {
+            options.tracePath = argv[++i];
+        } else if (std::strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+        } else {
+            return false;
+        }
+    }
+    return options.matches > 0 && options.maxTurns > 0 && options.actionsPerTurn >= 0 &&
+           options.mctsIterations >= 0;
+}
+
+// Pick a random cell inside the diamond board
+Position randomCell(std::mt19937& rng) {
+    std::uniform_int_distribution<int> coord(-Board::RADIUS, Board::RADIUS);
+    Position pos;
+    do {
+        pos = Position(coord(rng), coord(rng));
+    } while (!Board::isValid(pos));
+    return pos;
+}
+
+Position randomNodePosition(const Player& player, std::mt19937& rng) {
+    const auto& nodes = player.getNodes();
+    std::uniform_int_distribution<size_t> pick(0, nodes.size() - 1);
+    return nodes[pick(rng)].getPosition();
+}
+
+// Random policy: hack targets an enemy node, defend targets an own node,
+// everything else targets a random cell.
+void submitRandomAction(GameState& game, int playerId, std::mt19937& rng) {
+    std::uniform_int_distribution<int> pickAction(0, static_cast<int>(ActionType::COUNT) - 1);
+    ActionType actionType = static_cast<ActionType>(pickAction(rng));
+
+    Position target;
+    if (actionType == ActionType::HACK) {
+        target = randomNodePosition(game.getPlayer(1 - playerId), rng);
+    } else if (actionType == ActionType::DEFEND) {
+        target = randomNodePosition(game.getPlayer(playerId), rng);
+    } else {
+        target = randomCell(rng);
+    }
+
+    game.submitAction(playerId, actionType, target);
+}
+
+void playRandomMatch(const Options& options, std::mt19937& rng, MctsSearch& search, Totals& totals) {
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+    std::vector<Action> planned;
+
+    while (!game.isGameOver() && game.getCurrentTurn() <= options.maxTurns) {
+        if (options.mctsIterations > 0) {
+            search.search(game, 0, planned);
+        }
+        for (int playerId = 0; playerId < 2; ++playerId) {
+            for (int i = 0; i < options.actionsPerTurn; ++i) {
+                if (playerId == 0 && options.mctsIterations > 0) {
+                    if (i < static_cast<int>(planned.size())) {
+                        game.submitAction(0, planned[i].type, planned[i].targetPos, planned[i].unit);
+                    }
+                } else {
+                    submitRandomAction(game, playerId, rng);
+                }
+                totals.actions++;
+            }
+        }
+        game.endTurn();
+        totals.turns++;
+    }
+
+    Metrics::Array metrics;
+    game.getMetrics(metrics);
+    totals.arenaHeapAllocations = metrics[Metrics::WORD_ARENA_HEAP_ALLOCATIONS];
+
+    totals.matches++;
+    if (game.isGameOver()) {
+        totals.wins[game.getWinner()]++;
+    } else {
+        totals.draws++;
+    }
+}
+
+int runRandomMatches(const Options& options) {
+    std::mt19937 rng(options.seed);
+    Totals totals;
+
+    MctsConfig config;
+    config.iterations = options.mctsIterations;
+    config.actionsPerTurn = options.actionsPerTurn;
+    config.seed = options.seed;
+    MctsSearch search(config);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < options.matches; ++i) {
+        playRandomMatch(options, rng, search, totals);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    if (seconds <= 0.0) {
+        seconds = 1e-9;
+    }
+
+    std::cout << "matches:         " << totals.matches << "\n"
+              << "turns:           " << totals.turns << "\n"
+              << "actions:         " << totals.actions << "\n"
+              << "wins p0/p1/draw: " << totals.wins[0] << "/" << totals.wins[1]
+              << "/" << totals.draws << "\n"
+              << "elapsed (s):     " << seconds << "\n"
+              << "matches/sec:     " << totals.matches / seconds << "\n"
+              << "turns/sec:       " << totals.turns / seconds << std::endl;
+
+    // Steady-state turns must fit in the turn arena's block
+    if (totals.arenaHeapAllocations != 0) {
+        std::cerr << "Turn arena fell back to the heap " << totals.arenaHeapAllocations << " times" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int runScript(const Options& options) {
+    std::ifstream script(options.scriptPath);
+    if (!script) {
+        std::cerr << "Cannot open script: " << options.scriptPath << std::endl;
+        return 1;
+    }
+
+    GameState game;
+    game.initializeGame("Player 1", "Player 2");
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(script, line)) {
+        lineNumber++;
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+
+        std::istringstream in(line);
+        std::string command;
+        if (!(in >> command)) {
+            continue;
+        }
+
+        if (command == "submit") {
+            int playerId = 0;
+            int x = 0;
+            int y = 0;
+            std::string actionName;
+            ActionType actionType;
+            if (!(in >> playerId >> actionName >> x >> y)) {
+                std::cerr << options.scriptPath << ":" << lineNumber << ": malformed submit" << std::endl;
+                return 1;
+            }
+            if (!parseActionType(actionName, actionType)) {
+                std::cerr << options.scriptPath << ":" << lineNumber << ": unknown action '"
+                          << actionName << "'" << std::endl;
+                return 1;
+            }
+            game.submitAction(playerId, actionType, Position(x, y));
+        } else if (command == "end") {
+            game.endTurn();
+        } else {
+            std::cerr << options.scriptPath << ":" << lineNumber << ": unknown command '"
+                      << command << "'" << std::endl;
+            return 1;
+        }
+    }
+
+    for (const auto& entry : game.getGameLog()) {
+        std::cout << entry << "\n";
+    }
+    std::cout << "turn: " << game.getCurrentTurn() << ", winner: " << game.getWinner() << std::endl;
+
+    if (options.verbose) {
+        std::cout << game.serializeState() << std::endl;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    int status = options.scriptPath.empty() ? runRandomMatches(options) : runScript(options);
+    if (!options.tracePath.empty()) {
+        if (!Trace::isEnabled()) {
+            std::cerr << "Warning: built without tracing (make TRACE=1); the trace is empty" << std::endl;
+        }
+        std::string trace;
+        Trace::writeJson(trace);
+        std::ofstream file(options.tracePath);
+        file << trace;
+        if (!file) {
+            std::cerr << "Error: could not write " << options.tracePath << std::endl;
+            return 1;
+        }
+    }
+    return status;
+}